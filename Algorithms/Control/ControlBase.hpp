@@ -8,14 +8,54 @@
 #define FINEMOTE_CONTROLBASE_HPP
 
 #include <array>
-#include <vector>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#define CONTROLLER_MAX_FEEDBACKS 4  // 单个控制器可绑定的反馈量个数上限，即级联的最大层数
+
+/**
+ * 反馈量地址表，由外环到内环依次对应级联的各层；定长存放于对象内部，按值传递，不分配内存
+ */
+class FeedbackList_t {
+public:
+    constexpr FeedbackList_t() = default;
+
+    template<typename... Ptrs>
+    constexpr FeedbackList_t(float* first, Ptrs... rest) : ptrs{first, rest...}, count(1 + sizeof...(Ptrs)) {
+        static_assert(1 + sizeof...(Ptrs) <= CONTROLLER_MAX_FEEDBACKS, "Too many feedbacks");
+    }
+
+    template<size_t N>
+    constexpr FeedbackList_t(const std::array<float*, N>& feedbackPtrs) : count(N) {
+        static_assert(N <= CONTROLLER_MAX_FEEDBACKS, "Too many feedbacks");
+        for (size_t i = 0; i < N; ++i) {
+            ptrs[i] = feedbackPtrs[i];
+        }
+    }
+
+    constexpr size_t size() const {
+        return count;
+    }
+
+    constexpr float* operator[](size_t i) const {
+        return ptrs[i];
+    }
+
+private:
+    std::array<float*, CONTROLLER_MAX_FEEDBACKS> ptrs = {};
+    size_t count = 0;
+};
 
 /**
  * 控制器的输出应当不是一个立即数，而是根据指定地址存放数据，从而保证实际控制发生前控制量的生命周期
+ * @note 派生类以FEEDBACKS声明需要的反馈量个数，即闭环的级联层数；绑定时据此检查反馈表
  */
 
 class ControllerBase {
 public:
+    static constexpr size_t FEEDBACKS = 1;
+
     ControllerBase() = default;
     explicit ControllerBase(float* _targetPtr) : targetPtr(_targetPtr) {}
 
@@ -33,8 +73,18 @@ public:
         this->targetPtr = _targetPtr;
     }
 
-    virtual void SetFeedback(const std::vector<float*>& feedbackPtrs) {
-        this->feedbackPtr = feedbackPtrs[0];
+    /**
+     * 绑定反馈量，反馈表的长度应不小于FEEDBACKS，由调用者检查
+     */
+    virtual void SetFeedback(const FeedbackList_t& feedbackPtrs) {
+        this->feedbackPtr = feedbackPtrs.size() > 0 ? feedbackPtrs[0] : nullptr;
+    }
+
+    /**
+     * 清除积分、微分等内部状态与输出，用于反馈中断或重新使能后从零开始控制
+     */
+    virtual void Reset() {
+        output = 0;
     }
 
 protected:
@@ -43,6 +93,26 @@ protected:
     float output = 0;
 };
 
+/**
+ * 以具体类型调用Calc，不经过虚函数表，级联的各层在编译期展开并可整体内联
+ * @note 电机等在绑定控制器时保存&ControllerCalc<T>，控制周期内通过该函数指针计算
+ */
+template<typename T>
+const float& ControllerCalc(ControllerBase& controller) {
+    static_assert(std::is_base_of<ControllerBase, T>::value, "T should be derived from ControllerBase");
+    return static_cast<T&>(controller).T::Calc();
+}
+
+/**
+ * 控制器类型与反馈个数在编译期确定时绑定目标与反馈，反馈个数须等于控制器的级联层数
+ */
+template<typename T, size_t N>
+void BindController(T& controller, float* target, const std::array<float*, N>& feedbackPtrs) {
+    static_assert(N == T::FEEDBACKS, "Feedback number should be equal to the number of cascade layers");
+    controller.SetTarget(target);
+    controller.SetFeedback(feedbackPtrs);
+}
+
 template<typename T, size_t M, typename... Args, size_t... I>
 std::array<T, M> CreateControllersImpl(std::index_sequence<I...>, Args&&... args) {
     return { (static_cast<void>(I), T{std::forward<Args>(args)...})... };
@@ -61,8 +131,14 @@ auto CreateControllers(Args&&... args) {
     return CreateControllersImpl<T<N>, M>(std::make_index_sequence<M>{}, std::forward<Args>(args)...);
 }
 
+/**
+ * 开环比例环节，不使用反馈
+ */
 template <size_t K = 1>
 class Amplifier : public ControllerBase {
+public:
+    static constexpr size_t FEEDBACKS = 0;
+
     const float& Calc() final {
         output = K * (*targetPtr);
         return output;
@@ -7,8 +7,6 @@
 #ifndef FINEMOTE_PID_HPP
 #define FINEMOTE_PID_HPP
 
-#include <vector>
-
 #include "ControlBase.hpp"
 
 typedef struct PID_Param_t {
@@ -32,6 +30,12 @@ public:
         return Clamp(output, -1 * params.outputMax, params.outputMax);
     }
 
+    void Reset() override {
+        ControllerBase::Reset();
+        totalError = 0;
+        lastError = 0;
+    }
+
 private:
     const PID_Param_t params;
     float totalError = 0, lastError = 0;
@@ -40,6 +44,8 @@ private:
 template<size_t K>
 class CascadePID : public PID {
 public:
+    static constexpr size_t FEEDBACKS = K;
+
     template<typename... Params>
     constexpr explicit CascadePID(const PID_Param_t& first, Params... params) : PID(first), nodes{PID(params)...} {
         static_assert(K > 1, "CascadePID should have at least 2 layers");
@@ -53,22 +59,30 @@ public:
     const float& Calc() final{
         PID::Calc();
         for(auto& node : nodes) {
-            node.Calc();
+            node.PID::Calc();
         }
 
         output = nodes.rbegin()->GetOutput();
         return output;
     }
 
-    void SetFeedback(const std::vector<float*>& feedbackPtrs) final {
-        //static_assert(K == feedbackPtrs.size(), "Feedback number should be equal to K");
-
-        auto iter = feedbackPtrs.begin();
-        PID::SetFeedback({*iter});
-        iter++;
+    void Reset() final {
+        PID::Reset();
         for(auto& node : nodes) {
-            node.SetFeedback({*iter});
-            iter++;
+            node.PID::Reset();
+        }
+    }
+
+    /**
+     * 反馈表由外环到内环依次绑定到各层，长度不足K时不绑定
+     */
+    void SetFeedback(const FeedbackList_t& feedbackPtrs) final {
+        if (feedbackPtrs.size() < K) {
+            return;
+        }
+        PID::SetFeedback({feedbackPtrs[0]});
+        for (size_t i = 0; i < K - 1; ++i) {
+            nodes[i].PID::SetFeedback({feedbackPtrs[i + 1]});
         }
     }
 
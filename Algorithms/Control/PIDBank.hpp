@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_PIDBANK_HPP
+#define FINEMOTE_PIDBANK_HPP
+
+#include <cstdint>
+
+#include "PID.hpp"
+
+#if defined(ARM_MATH_CM4)
+#include "arm_math.h"
+#endif
+
+/**
+ * N路PID的批量计算，增益、积分与误差按结构数组存放，一次遍历计算全部回路
+ * @note 目标板上逐项调用CMSIS-DSP的arm_*_f32，主机上为可由编译器自动向量化的连续循环
+ * @note operator[]返回第i路的控制器，可像PID一样绑定到电机，电机仍通过GetOutput()读取本路的控制量
+ * @note 每个周期第一个计算的成员执行一次批量计算，其余成员直接取本周期的结果，控制量没有额外的延迟；
+ *       某一回路在上次批量计算之后再次计算即视为进入新的周期，因此各成员须每周期计算一次，即分频系数相同
+ * @note 批量计算读取全部回路的反馈，各路反馈须在本周期第一个成员计算之前更新，如在接收中断中解析，此时结果与PID逐个计算完全相同；
+ *       若电机在各自的Handle中解析反馈，除第一个计算的成员外，其余回路使用的是上一周期的反馈
+ */
+template<size_t N>
+class PIDBank {
+public:
+    class Loop : public ControllerBase {
+    public:
+        const float& Calc() final {
+            if (bank->calculated[index]) {
+                bank->Run();
+            }
+            bank->calculated[index] = true;
+            output = bank->out[index];
+            return output;
+        }
+
+        void Reset() final {
+            ControllerBase::Reset();
+            bank->ResetLoop(index);
+        }
+
+    private:
+        friend class PIDBank;
+
+        PIDBank* bank = nullptr;
+        size_t index = 0;
+    };
+
+    explicit PIDBank(const PID_Param_t& params) {
+        for (size_t i = 0; i < N; ++i) {
+            SetParam(i, params);
+        }
+        Init();
+    }
+
+    explicit PIDBank(const std::array<PID_Param_t, N>& params) {
+        for (size_t i = 0; i < N; ++i) {
+            SetParam(i, params[i]);
+        }
+        Init();
+    }
+
+    PIDBank(const PIDBank&) = delete;
+
+    PIDBank& operator=(const PIDBank&) = delete;
+
+    Loop& operator[](size_t i) {
+        return loops[i];
+    }
+
+    void SetParam(size_t i, const PID_Param_t& params) {
+        kp[i] = params.kp;
+        ki[i] = params.ki;
+        kd[i] = params.kd;
+        iMax[i] = params.iMax;
+        outputMax[i] = params.outputMax;
+    }
+
+private:
+    /**
+     * 读取全部回路的目标与反馈并计算控制量，由每个周期第一个计算的成员调用
+     */
+    void Run() {
+        for (size_t i = 0; i < N; ++i) {
+            calculated[i] = false;
+            target[i] = *loops[i].targetPtr;
+            feedback[i] = *loops[i].feedbackPtr;
+        }
+#if defined(ARM_MATH_CM4)
+        arm_sub_f32(target, feedback, error, N);
+        arm_add_f32(totalError, error, totalError, N);
+        ClampAll(totalError, iMax);
+        arm_sub_f32(error, lastError, derivative, N);
+        arm_mult_f32(kp, error, out, N);
+        arm_mult_f32(ki, totalError, term, N);
+        arm_add_f32(out, term, out, N);
+        arm_mult_f32(kd, derivative, term, N);
+        arm_add_f32(out, term, out, N);
+        ClampAll(out, outputMax);
+        arm_copy_f32(error, lastError, N);
+#else
+        for (size_t i = 0; i < N; ++i) {
+            float e = target[i] - feedback[i];
+            float integral = Limit(totalError[i] + e, iMax[i]);
+            out[i] = Limit(kp[i] * e + ki[i] * integral + kd[i] * (e - lastError[i]), outputMax[i]);
+            totalError[i] = integral;
+            lastError[i] = e;
+        }
+#endif
+    }
+
+    void Init() {
+        for (size_t i = 0; i < N; ++i) {
+            calculated[i] = true;
+            loops[i].bank = this;
+            loops[i].index = i;
+            loops[i].SetTarget(&unbound);
+            loops[i].SetFeedback({&unbound});
+        }
+    }
+
+    void ResetLoop(size_t i) {
+        totalError[i] = 0;
+        lastError[i] = 0;
+        out[i] = 0;
+    }
+
+    static float Limit(float value, float limit) {
+        return value > limit ? limit : (value < -limit ? -limit : value);
+    }
+
+    static void ClampAll(float* value, const float* limit) {
+        for (size_t i = 0; i < N; ++i) {
+            value[i] = Limit(value[i], limit[i]);
+        }
+    }
+
+    float kp[N], ki[N], kd[N], iMax[N], outputMax[N];
+    float target[N] = {}, feedback[N] = {}, totalError[N] = {}, lastError[N] = {}, out[N] = {};
+#if defined(ARM_MATH_CM4)
+    float error[N] = {}, derivative[N] = {}, term[N] = {};
+#endif
+    bool calculated[N];     // 本路已取走最近一次批量计算的结果
+    Loop loops[N];
+    float unbound = 0;      // 未绑定的回路指向此处
+};
+
+#endif
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_PIDEX_HPP
+#define FINEMOTE_PIDEX_HPP
+
+#include <cstdint>
+
+#include "Clamp.hpp"
+#include "ControlBase.hpp"
+#include "Profiler/CycleCounter.hpp"
+
+/**
+ * PIDEx的可选功能，按位或组合后作为模板参数，未选用的功能在编译期剔除
+ */
+enum PIDEx_Feature_e : uint32_t {
+    PIDEX_D_FILTER = 1u << 0,               // 微分项一阶低通滤波
+    PIDEX_D_ON_MEASUREMENT = 1u << 1,       // 微分作用于反馈而非误差，目标阶跃时不产生微分冲击
+    PIDEX_BACK_CALCULATION = 1u << 2,       // 反算抗积分饱和，以限幅前后的输出之差回调积分
+    PIDEX_CONDITIONAL_INTEGRATION = 1u << 3,// 条件积分，输出饱和且误差使其加深时暂停积分
+    PIDEX_FEED_FORWARD = 1u << 4,           // 速度与加速度前馈
+    PIDEX_SLEW_LIMIT = 1u << 5,             // 输出变化率限制
+    PIDEX_MEASURED_DT = 1u << 6,            // 按实测的调用间隔修正积分与微分
+};
+
+typedef struct PIDEx_Param_t {
+    float kp;
+    float ki;
+    float kd;
+    float iMax;
+    float outputMax;
+    float dFilter = 0;      // 微分低通的时间常数，单位为名义周期，0为不滤波
+    float kb = 0;           // 反算增益，作用于误差积分，典型取值为1/kp
+    float kv = 0;           // 速度前馈增益
+    float ka = 0;           // 加速度前馈增益
+    float slewRate = 0;     // 每个名义周期输出的最大变化量
+    float period = 0.001f;  // 名义控制周期，单位s，即电机的分频系数除以调度频率
+} PIDEx_Param_t;
+
+/**
+ * 可选功能的PID，FEATURES为PIDEx_Feature_e的组合，不含任何功能时与PID的计算相同
+ * @note 增益的单位与PID相同，均以名义周期为时间单位；启用PIDEX_MEASURED_DT时，积分与微分按实测间隔与名义周期之比缩放，
+ *       分频运行或调度延迟时无需重新整定
+ * @note 前馈输入通过SetFeedForward绑定，如轨迹给出的目标速度与加速度，未绑定时为零
+ * @note Source为实测调用间隔所用的周期计数源，与Profiler相同
+ */
+template<uint32_t FEATURES = 0, typename Source = DefaultCycleSource>
+class PIDEx : public ControllerBase {
+public:
+    explicit PIDEx(const PIDEx_Param_t& params) : params(params) {
+        if constexpr ((FEATURES & PIDEX_MEASURED_DT) != 0) {
+            CycleCounter<Source>::Init();
+        }
+    }
+
+    const float& Calc() final {
+        float scale = 1;
+        if constexpr ((FEATURES & PIDEX_MEASURED_DT) != 0) {
+            uint32_t now = CycleCounter<Source>::Now();
+            if (started) {
+                scale = static_cast<float>(now - lastTime) / (params.period * CycleCounter<Source>::Frequency());
+                Clamp(scale, 0.1f, 10.f);
+            }
+            lastTime = now;
+        }
+
+        const float feedback = *feedbackPtr;
+        const float error = *targetPtr - feedback;
+
+        float derivative;
+        if constexpr ((FEATURES & PIDEX_D_ON_MEASUREMENT) != 0) {
+            derivative = started ? lastFeedback - feedback : 0;
+            lastFeedback = feedback;
+        } else {
+            derivative = error - lastError;
+        }
+        lastError = error;
+        if constexpr ((FEATURES & PIDEX_MEASURED_DT) != 0) {
+            derivative /= scale;
+        }
+        if constexpr ((FEATURES & PIDEX_D_FILTER) != 0) {
+            filteredDerivative += scale / (params.dFilter + scale) * (derivative - filteredDerivative);
+            derivative = filteredDerivative;
+        }
+        started = true;
+
+        float feedForward = 0;
+        if constexpr ((FEATURES & PIDEX_FEED_FORWARD) != 0) {
+            feedForward = params.kv * *velocityPtr + params.ka * *accelerationPtr;
+        }
+
+        bool integrate = true;
+        if constexpr ((FEATURES & PIDEX_CONDITIONAL_INTEGRATION) != 0) {
+            float previous = params.kp * error + params.ki * totalError + params.kd * derivative + feedForward;
+            bool saturated = previous > params.outputMax || previous < -params.outputMax;
+            integrate = !saturated || error * previous < 0;
+        }
+        if (integrate) {
+            totalError += error * scale;
+        }
+        Clamp(totalError, -1 * params.iMax, params.iMax);
+
+        // 与PID按相同的顺序求和，不含任何功能时结果逐位相同
+        const float unsaturated = params.kp * error + params.ki * totalError + params.kd * derivative + feedForward;
+        float result = unsaturated;
+        Clamp(result, -1 * params.outputMax, params.outputMax);
+        if constexpr ((FEATURES & PIDEX_SLEW_LIMIT) != 0) {
+            float step = params.slewRate * scale;
+            result = output + Clamp(result - output, -step, step);
+        }
+        if constexpr ((FEATURES & PIDEX_BACK_CALCULATION) != 0) {
+            totalError += params.kb * (result - unsaturated) * scale;
+            Clamp(totalError, -1 * params.iMax, params.iMax);
+        }
+
+        output = result;
+        return output;
+    }
+
+    void Reset() final {
+        ControllerBase::Reset();
+        totalError = 0;
+        lastError = 0;
+        lastFeedback = 0;
+        filteredDerivative = 0;
+        started = false;
+    }
+
+    /**
+     * 绑定前馈输入，需启用PIDEX_FEED_FORWARD
+     */
+    void SetFeedForward(const float* velocity, const float* acceleration = nullptr) {
+        static_assert((FEATURES & PIDEX_FEED_FORWARD) != 0, "Feed-forward is not enabled");
+        velocityPtr = velocity != nullptr ? velocity : &zero;
+        accelerationPtr = acceleration != nullptr ? acceleration : &zero;
+    }
+
+private:
+    static constexpr float zero = 0;
+
+    const PIDEx_Param_t params;
+    float totalError = 0, lastError = 0, lastFeedback = 0, filteredDerivative = 0;
+    const float* velocityPtr = &zero;
+    const float* accelerationPtr = &zero;
+    uint32_t lastTime = 0;
+    bool started = false;
+};
+
+#endif
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_CRITICALSECTION_HPP
+#define FINEMOTE_CRITICALSECTION_HPP
+
+#include <cstdint>
+
+#include "Board.h"
+
+#if defined(__CORTEX_M) || defined(__HOSTSIM)
+
+/**
+ * 作用域内屏蔽中断，析构时恢复进入前的PRIMASK，可在中断与嵌套的临界区中使用
+ * @note 只用于保护少量指令，如队列的入队出队，不可在其中等待外设
+ */
+class CriticalSection {
+public:
+    CriticalSection() : primask(__get_PRIMASK()) {
+        __disable_irq();
+    }
+
+    ~CriticalSection() {
+        __set_PRIMASK(primask);
+    }
+
+    CriticalSection(const CriticalSection &) = delete;
+
+    CriticalSection &operator=(const CriticalSection &) = delete;
+
+private:
+    uint32_t primask;
+};
+
+#else
+
+/**
+ * 无中断的主机构建中无需屏蔽；主机仿真使用仿真的PRIMASK，以便检查临界区中的外设调用
+ */
+class CriticalSection {
+public:
+    CriticalSection() = default;
+
+    CriticalSection(const CriticalSection &) = delete;
+
+    CriticalSection &operator=(const CriticalSection &) = delete;
+};
+
+#endif
+
+#endif
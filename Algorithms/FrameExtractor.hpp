@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_FRAME_EXTRACTOR_HPP
+#define FINEMOTE_FRAME_EXTRACTOR_HPP
+
+#include <functional>
+
+#include "RingBuffer.hpp"
+
+/**
+ * 帧格式描述，由各协议的解码类提供
+ */
+typedef struct {
+    uint8_t header;                                     // 帧头字节，用于重新同步
+    size_t prefixLength;                                // 确定帧长所需的字节数，包括帧头
+    size_t (*frameLength)(const uint8_t *prefix);       // 根据前缀返回整帧长度，返回0表示前缀非法
+    bool (*frameCheck)(const uint8_t *frame, size_t size); // 整帧校验（帧尾、CRC等），可为nullptr
+} FrameFormat_t;
+
+typedef struct {
+    uint32_t frames;        // 提取出的完整帧数
+    uint32_t skippedBytes;  // 为重新同步丢弃的字节数
+    uint32_t badFrames;     // 帧长非法或校验失败的候选帧数
+} FrameExtractor_Stats_t;
+
+/**
+ * 从字节流中按帧头重新同步并提取完整帧，帧可以跨越任意多次接收事件
+ * @tparam MAX_FRAME 最大帧长，超出的候选帧视为非法
+ * @note 在消费者上下文（任务或设备Handle）中调用Poll，解码回调因此不在中断中执行
+ */
+template<size_t MAX_FRAME>
+class FrameExtractor {
+public:
+    FrameExtractor(const FrameFormat_t &_format, std::function<void(uint8_t *, size_t)> decodeCallback) :
+        format(_format), DecodeCallback(decodeCallback) {}
+
+    /**
+     * 尝试从ring头部提取一帧，不完整的帧保留在ring中等待后续数据
+     * @return 帧长，0表示暂无完整帧；帧内容通过GetFrame()获取，在下次提取前有效
+     */
+    template<size_t N>
+    size_t Extract(RingBuffer<N> &ring) {
+        static_assert(N >= MAX_FRAME, "RingBuffer should hold a complete frame");
+        while (true) {
+            size_t available = ring.Size();
+            size_t skip = 0;
+            while (skip < available && ring.At(skip) != format.header) {
+                skip++;
+            }
+            if (skip > 0) {
+                ring.Skip(skip);
+                stats.skippedBytes += skip;
+                available -= skip;
+            }
+            if (available < format.prefixLength) {
+                return 0;
+            }
+
+            ring.Peek(frame, format.prefixLength);
+            size_t length = format.frameLength(frame);
+            if (length < format.prefixLength || length > MAX_FRAME) {
+                Resync(ring);
+                continue;
+            }
+            if (available < length) {
+                return 0;
+            }
+
+            ring.Peek(frame, length);
+            if (format.frameCheck != nullptr && !format.frameCheck(frame, length)) {
+                Resync(ring);
+                continue;
+            }
+            ring.Skip(length);
+            stats.frames++;
+            return length;
+        }
+    }
+
+    /**
+     * 提取ring中所有完整帧并依次调用解码回调
+     * @return 本次解码的帧数
+     */
+    template<size_t N>
+    size_t Poll(RingBuffer<N> &ring) {
+        size_t count = 0;
+        for (size_t length = Extract(ring); length > 0; length = Extract(ring)) {
+            DecodeCallback(frame, length);
+            count++;
+        }
+        return count;
+    }
+
+    uint8_t *GetFrame() {
+        return frame;
+    }
+
+    const FrameExtractor_Stats_t &GetStats() const {
+        return stats;
+    }
+
+private:
+    /**
+     * 当前帧头是数据中的伪帧头，丢弃该字节后从下一个帧头继续搜索
+     */
+    template<size_t N>
+    void Resync(RingBuffer<N> &ring) {
+        ring.Skip(1);
+        stats.skippedBytes++;
+        stats.badFrames++;
+    }
+
+    FrameFormat_t format;
+    std::function<void(uint8_t *, size_t)> DecodeCallback;
+    uint8_t frame[MAX_FRAME] = {};
+    FrameExtractor_Stats_t stats = {};
+};
+
+#endif
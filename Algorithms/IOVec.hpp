@@ -0,0 +1,29 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_IOVEC_HPP
+#define FINEMOTE_IOVEC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * 分段数据描述，用于帧头、负载、校验等分别存放的报文，发送与校验时按顺序拼接
+ */
+typedef struct {
+    const uint8_t *data;
+    uint16_t size;
+} IOVec_t;
+
+inline size_t IOVecSize(const IOVec_t *segments, size_t count) {
+    size_t size = 0;
+    for (size_t i = 0; i < count; ++i) {
+        size += segments[i].size;
+    }
+    return size;
+}
+
+#endif
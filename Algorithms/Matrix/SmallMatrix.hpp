@@ -0,0 +1,449 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_SMALLMATRIX_HPP
+#define FINEMOTE_SMALLMATRIX_HPP
+
+#include <cmath>
+#include <cstddef>
+
+/**
+ * 编译期定尺寸的小矩阵，数据按行存放于对象内部，不依赖CMSIS-DSP
+ * @note 尺寸均为常量，各运算的循环在编译期展开；参数均以引用传递，运算结果依赖返回值优化，不产生额外的复制
+ * @note 接口与Matrixf保持一致，行访问为m[row][col]，可直接替换Matrixf；默认构造为零矩阵
+ */
+template<size_t R, size_t C>
+class SMatrixf {
+public:
+    static constexpr size_t ROWS = R;
+    static constexpr size_t COLS = C;
+
+    constexpr SMatrixf() = default;
+
+    constexpr SMatrixf(const float (&data)[R * C]) {
+        for (size_t i = 0; i < R * C; ++i) {
+            data_[i] = data[i];
+        }
+    }
+
+    explicit constexpr SMatrixf(const float* data) {
+        for (size_t i = 0; i < R * C; ++i) {
+            data_[i] = data[i];
+        }
+    }
+
+    constexpr size_t rows() const {
+        return R;
+    }
+
+    constexpr size_t cols() const {
+        return C;
+    }
+
+    constexpr float* operator[](size_t row) {
+        return &data_[row * C];
+    }
+
+    constexpr const float* operator[](size_t row) const {
+        return &data_[row * C];
+    }
+
+    constexpr float& operator()(size_t row, size_t col) {
+        return data_[row * C + col];
+    }
+
+    constexpr const float& operator()(size_t row, size_t col) const {
+        return data_[row * C + col];
+    }
+
+    constexpr float* data() {
+        return data_;
+    }
+
+    constexpr const float* data() const {
+        return data_;
+    }
+
+    constexpr SMatrixf& operator+=(const SMatrixf& mat) {
+        for (size_t i = 0; i < R * C; ++i) {
+            data_[i] += mat.data_[i];
+        }
+        return *this;
+    }
+
+    constexpr SMatrixf& operator-=(const SMatrixf& mat) {
+        for (size_t i = 0; i < R * C; ++i) {
+            data_[i] -= mat.data_[i];
+        }
+        return *this;
+    }
+
+    constexpr SMatrixf& operator*=(float val) {
+        for (size_t i = 0; i < R * C; ++i) {
+            data_[i] *= val;
+        }
+        return *this;
+    }
+
+    constexpr SMatrixf& operator/=(float val) {
+        return *this *= 1.f / val;
+    }
+
+    constexpr SMatrixf operator+(const SMatrixf& mat) const {
+        SMatrixf res = *this;
+        res += mat;
+        return res;
+    }
+
+    constexpr SMatrixf operator-(const SMatrixf& mat) const {
+        SMatrixf res = *this;
+        res -= mat;
+        return res;
+    }
+
+    constexpr SMatrixf operator-() const {
+        SMatrixf res = *this;
+        res *= -1.f;
+        return res;
+    }
+
+    constexpr SMatrixf operator*(float val) const {
+        SMatrixf res = *this;
+        res *= val;
+        return res;
+    }
+
+    constexpr SMatrixf operator/(float val) const {
+        SMatrixf res = *this;
+        res *= 1.f / val;
+        return res;
+    }
+
+    friend constexpr SMatrixf operator*(float val, const SMatrixf& mat) {
+        return mat * val;
+    }
+
+    template<size_t rows, size_t cols>
+    constexpr SMatrixf<rows, cols> block(size_t startRow, size_t startCol) const {
+        SMatrixf<rows, cols> res;
+        for (size_t row = 0; row < rows; ++row) {
+            for (size_t col = 0; col < cols; ++col) {
+                res[row][col] = (*this)[startRow + row][startCol + col];
+            }
+        }
+        return res;
+    }
+
+    constexpr SMatrixf<1, C> row(size_t row) const {
+        return block<1, C>(row, 0);
+    }
+
+    constexpr SMatrixf<R, 1> col(size_t col) const {
+        return block<R, 1>(0, col);
+    }
+
+    constexpr SMatrixf<C, R> trans() const {
+        SMatrixf<C, R> res;
+        for (size_t row = 0; row < R; ++row) {
+            for (size_t col = 0; col < C; ++col) {
+                res[col][row] = (*this)[row][col];
+            }
+        }
+        return res;
+    }
+
+    constexpr float trace() const {
+        float res = 0;
+        for (size_t i = 0; i < (R < C ? R : C); ++i) {
+            res += (*this)[i][i];
+        }
+        return res;
+    }
+
+    /**
+     * 所有元素平方和的平方根，对列向量即为模长
+     */
+    float norm() const {
+        float res = 0;
+        for (size_t i = 0; i < R * C; ++i) {
+            res += data_[i] * data_[i];
+        }
+        return sqrtf(res);
+    }
+
+private:
+    float data_[R * C] = {};
+};
+
+template<size_t R, size_t C, size_t K>
+constexpr SMatrixf<R, K> operator*(const SMatrixf<R, C>& mat1, const SMatrixf<C, K>& mat2) {
+    SMatrixf<R, K> res;
+    for (size_t row = 0; row < R; ++row) {
+        for (size_t col = 0; col < K; ++col) {
+            float sum = 0;
+            for (size_t i = 0; i < C; ++i) {
+                sum += mat1[row][i] * mat2[i][col];
+            }
+            res[row][col] = sum;
+        }
+    }
+    return res;
+}
+
+namespace smatrixf {
+
+template<size_t R, size_t C>
+constexpr SMatrixf<R, C> zeros() {
+    return SMatrixf<R, C>();
+}
+
+template<size_t R, size_t C>
+constexpr SMatrixf<R, C> ones() {
+    SMatrixf<R, C> res;
+    for (size_t i = 0; i < R * C; ++i) {
+        res.data()[i] = 1;
+    }
+    return res;
+}
+
+template<size_t R, size_t C>
+constexpr SMatrixf<R, C> eye() {
+    SMatrixf<R, C> res;
+    for (size_t i = 0; i < (R < C ? R : C); ++i) {
+        res[i][i] = 1;
+    }
+    return res;
+}
+
+template<size_t R, size_t C>
+constexpr SMatrixf<R, C> diag(const SMatrixf<R, 1>& vec) {
+    SMatrixf<R, C> res;
+    for (size_t i = 0; i < (R < C ? R : C); ++i) {
+        res[i][i] = vec[i][0];
+    }
+    return res;
+}
+
+/**
+ * 求逆，2到4阶使用伴随矩阵的闭式解，更高阶使用原地的列主元Gauss-Jordan消元
+ * @note 与matrixf::inv相同，矩阵奇异时返回零矩阵
+ */
+template<size_t N>
+SMatrixf<N, N> inv(const SMatrixf<N, N>& mat) {
+    constexpr float SINGULAR = 1e-12f;
+    SMatrixf<N, N> res;
+    const SMatrixf<N, N>& a = mat;
+
+    if constexpr (N == 1) {
+        if (fabsf(a[0][0]) < SINGULAR) {
+            return res;
+        }
+        res[0][0] = 1.f / a[0][0];
+    } else if constexpr (N == 2) {
+        float det = a[0][0] * a[1][1] - a[0][1] * a[1][0];
+        if (fabsf(det) < SINGULAR) {
+            return res;
+        }
+        float k = 1.f / det;
+        res[0][0] = a[1][1] * k;
+        res[0][1] = -a[0][1] * k;
+        res[1][0] = -a[1][0] * k;
+        res[1][1] = a[0][0] * k;
+    } else if constexpr (N == 3) {
+        float c00 = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+        float c01 = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+        float c02 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+        float det = a[0][0] * c00 + a[0][1] * c01 + a[0][2] * c02;
+        if (fabsf(det) < SINGULAR) {
+            return res;
+        }
+        float k = 1.f / det;
+        res[0][0] = c00 * k;
+        res[0][1] = (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * k;
+        res[0][2] = (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * k;
+        res[1][0] = c01 * k;
+        res[1][1] = (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * k;
+        res[1][2] = (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * k;
+        res[2][0] = c02 * k;
+        res[2][1] = (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * k;
+        res[2][2] = (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * k;
+    } else if constexpr (N == 4) {
+        // 以前两行与后两行的2阶子式展开
+        float s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+        float s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+        float s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+        float s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+        float s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+        float s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+        float c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+        float c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+        float c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+        float c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+        float c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+        float c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+        float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (fabsf(det) < SINGULAR) {
+            return res;
+        }
+        float k = 1.f / det;
+        res[0][0] = (a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * k;
+        res[0][1] = (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * k;
+        res[0][2] = (a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * k;
+        res[0][3] = (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * k;
+        res[1][0] = (-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * k;
+        res[1][1] = (a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * k;
+        res[1][2] = (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * k;
+        res[1][3] = (a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * k;
+        res[2][0] = (a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * k;
+        res[2][1] = (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * k;
+        res[2][2] = (a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * k;
+        res[2][3] = (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * k;
+        res[3][0] = (-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * k;
+        res[3][1] = (a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * k;
+        res[3][2] = (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * k;
+        res[3][3] = (a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * k;
+    } else {
+        SMatrixf<N, N> work = mat;
+        res = eye<N, N>();
+        for (size_t i = 0; i < N; ++i) {
+            size_t pivot = i;
+            for (size_t row = i + 1; row < N; ++row) {
+                if (fabsf(work[row][i]) > fabsf(work[pivot][i])) {
+                    pivot = row;
+                }
+            }
+            if (fabsf(work[pivot][i]) < SINGULAR) {
+                return zeros<N, N>();
+            }
+            if (pivot != i) {
+                for (size_t col = 0; col < N; ++col) {
+                    float tmp = work[i][col];
+                    work[i][col] = work[pivot][col];
+                    work[pivot][col] = tmp;
+                    tmp = res[i][col];
+                    res[i][col] = res[pivot][col];
+                    res[pivot][col] = tmp;
+                }
+            }
+            float k = 1.f / work[i][i];
+            for (size_t col = 0; col < N; ++col) {
+                work[i][col] *= k;
+                res[i][col] *= k;
+            }
+            for (size_t row = 0; row < N; ++row) {
+                if (row == i) {
+                    continue;
+                }
+                k = work[row][i];
+                for (size_t col = 0; col < N; ++col) {
+                    work[row][col] -= k * work[i][col];
+                    res[row][col] -= k * res[i][col];
+                }
+            }
+        }
+    }
+    return res;
+}
+
+/**
+ * 对称正定矩阵的Cholesky分解 A = L * L^T
+ * @return 矩阵非正定时返回false
+ */
+template<size_t N>
+bool cholesky(const SMatrixf<N, N>& mat, SMatrixf<N, N>& lower) {
+    lower = zeros<N, N>();
+    for (size_t col = 0; col < N; ++col) {
+        float d = mat[col][col];
+        for (size_t i = 0; i < col; ++i) {
+            d -= lower[col][i] * lower[col][i];
+        }
+        if (d <= 0) {
+            return false;
+        }
+        lower[col][col] = sqrtf(d);
+        float k = 1.f / lower[col][col];
+        for (size_t row = col + 1; row < N; ++row) {
+            float s = mat[row][col];
+            for (size_t i = 0; i < col; ++i) {
+                s -= lower[row][i] * lower[col][i];
+            }
+            lower[row][col] = s * k;
+        }
+    }
+    return true;
+}
+
+/**
+ * 对称正定矩阵求逆，只读取下三角，结果严格对称；非正定时返回零矩阵
+ * @note 2、3阶按Sylvester判据检查正定后使用对称伴随矩阵的闭式解，更高阶经Cholesky分解得到 A^-1 = L^-T * L^-1
+ */
+template<size_t N>
+SMatrixf<N, N> inv_spd(const SMatrixf<N, N>& mat) {
+    const SMatrixf<N, N>& a = mat;
+    if constexpr (N == 2) {
+        SMatrixf<N, N> res;
+        float det = a[0][0] * a[1][1] - a[1][0] * a[1][0];
+        if (a[0][0] <= 0 || det <= 0) {
+            return res;
+        }
+        float k = 1.f / det;
+        res[0][0] = a[1][1] * k;
+        res[1][0] = res[0][1] = -a[1][0] * k;
+        res[1][1] = a[0][0] * k;
+        return res;
+    } else if constexpr (N == 3) {
+        SMatrixf<N, N> res;
+        float c00 = a[1][1] * a[2][2] - a[2][1] * a[2][1];
+        float c10 = a[2][1] * a[2][0] - a[1][0] * a[2][2];
+        float c20 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+        float minor = a[0][0] * a[1][1] - a[1][0] * a[1][0];
+        float det = a[0][0] * c00 + a[1][0] * c10 + a[2][0] * c20;
+        if (a[0][0] <= 0 || minor <= 0 || det <= 0) {
+            return res;
+        }
+        float k = 1.f / det;
+        res[0][0] = c00 * k;
+        res[1][0] = res[0][1] = c10 * k;
+        res[2][0] = res[0][2] = c20 * k;
+        res[1][1] = (a[0][0] * a[2][2] - a[2][0] * a[2][0]) * k;
+        res[2][1] = res[1][2] = (a[1][0] * a[2][0] - a[0][0] * a[2][1]) * k;
+        res[2][2] = minor * k;
+        return res;
+    }
+
+    SMatrixf<N, N> lower;
+    if (!cholesky(mat, lower)) {
+        return zeros<N, N>();
+    }
+    // 下三角矩阵的逆仍为下三角，逐列前代求解
+    SMatrixf<N, N> lowerInv;
+    for (size_t col = 0; col < N; ++col) {
+        lowerInv[col][col] = 1.f / lower[col][col];
+        for (size_t row = col + 1; row < N; ++row) {
+            float s = 0;
+            for (size_t i = col; i < row; ++i) {
+                s -= lower[row][i] * lowerInv[i][col];
+            }
+            lowerInv[row][col] = s / lower[row][row];
+        }
+    }
+    SMatrixf<N, N> res;
+    for (size_t row = 0; row < N; ++row) {
+        for (size_t col = row; col < N; ++col) {
+            float s = 0;
+            for (size_t i = col; i < N; ++i) {
+                s += lowerInv[i][row] * lowerInv[i][col];
+            }
+            res[row][col] = s;
+            res[col][row] = s;
+        }
+    }
+    return res;
+}
+
+}  // namespace smatrixf
+
+#endif
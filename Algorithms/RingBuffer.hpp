@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_RING_BUFFER_HPP
+#define FINEMOTE_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * 单生产者单消费者无锁字节环形缓冲区
+ * @tparam N 容量，需为2的幂
+ * @note 生产者（通常为串口中断）只调用Push，消费者（任务或设备Handle）只调用Size/Peek/Skip/Pop，双方无需关中断
+ * @note 读写位置为自由增长的计数，通过掩码取下标，满与空无需额外区分
+ */
+template<size_t N>
+class RingBuffer {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer size must be a power of 2");
+
+public:
+    /*** 生产者 ***/
+
+    /**
+     * @return 实际写入的字节数，空间不足时丢弃新数据并计入GetDropped()
+     */
+    size_t Push(const uint8_t *data, size_t size) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        size_t n = N - (h - t);
+        if (n > size) {
+            n = size;
+        }
+        dropped += size - n;
+
+        size_t offset = h & MASK;
+        size_t first = n < N - offset ? n : N - offset;
+        memcpy(buffer + offset, data, first);
+        memcpy(buffer, data + first, n - first);
+        head.store(h + n, std::memory_order_release);
+        return n;
+    }
+
+    /*** 消费者 ***/
+
+    size_t Size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+    }
+
+    uint8_t At(size_t offset) const {
+        return buffer[(tail.load(std::memory_order_relaxed) + offset) & MASK];
+    }
+
+    /**
+     * 从offset处复制数据但不移出
+     * @return 实际复制的字节数
+     */
+    size_t Peek(uint8_t *data, size_t size, size_t offset = 0) const {
+        size_t available = Size();
+        if (offset >= available) {
+            return 0;
+        }
+        if (size > available - offset) {
+            size = available - offset;
+        }
+
+        size_t start = (tail.load(std::memory_order_relaxed) + offset) & MASK;
+        size_t first = size < N - start ? size : N - start;
+        memcpy(data, buffer + start, first);
+        memcpy(data + first, buffer, size - first);
+        return size;
+    }
+
+    void Skip(size_t size) {
+        size_t available = Size();
+        if (size > available) {
+            size = available;
+        }
+        tail.store(tail.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    }
+
+    size_t Pop(uint8_t *data, size_t size) {
+        size = Peek(data, size);
+        Skip(size);
+        return size;
+    }
+
+    void Clear() {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    static constexpr size_t Capacity() {
+        return N;
+    }
+
+    uint32_t GetDropped() const {
+        return dropped;
+    }
+
+private:
+    static constexpr uint32_t MASK = N - 1;
+
+    uint8_t buffer[N] = {};
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+    uint32_t dropped = 0;
+};
+
+#endif
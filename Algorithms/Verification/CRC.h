@@ -8,11 +8,21 @@
 #define FINEMOTE_VERIFY_H
 
 #include "etl/crc.h"
+#include "IOVec.hpp"
 
-uint8_t CRC8Calc(uint8_t *data, uint16_t length);
+uint8_t CRC8Calc(const uint8_t *data, uint16_t length);
 
-uint16_t CRC16Calc(uint8_t *data, uint16_t length);
+uint16_t CRC16Calc(const uint8_t *data, uint16_t length);
 
-uint32_t CRC32Calc(uint8_t *data,uint16_t length);
+uint32_t CRC32Calc(const uint8_t *data, uint16_t length);
+
+/**
+ * 对按顺序拼接的多段数据计算校验，结果与拼接成连续缓冲区后计算相同
+ */
+uint8_t CRC8Calc(const IOVec_t *segments, size_t count);
+
+uint16_t CRC16Calc(const IOVec_t *segments, size_t count);
+
+uint32_t CRC32Calc(const IOVec_t *segments, size_t count);
 
 #endif
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Motors/Motor4010.hpp"
+#include "Control/PID.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * 多电机分组指令的测试：4台Motor4010以0x280分组发送转矩指令，其中一台停止写入后，其余电机的新指令仍应在同一周期发出
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 1;
+constexpr uint32_t GROUP_ADDR = 0x280;
+constexpr uint32_t FIRST_ADDR = 0x141;
+constexpr size_t MOTOR_COUNT = 4;
+
+int16_t slots[MOTOR_COUNT] = {};
+uint32_t groupFrames = 0;
+
+/**
+ * 总线上的电机：收到分组指令时记录各槽位，并由各电机回报速度为0的反馈
+ */
+void OnFrame(const HostSim_CANFrame_t &frame) {
+    if (frame.id != GROUP_ADDR) {
+        return;
+    }
+    groupFrames++;
+    for (size_t i = 0; i < MOTOR_COUNT; ++i) {
+        slots[i] = static_cast<int16_t>(frame.data[2 * i] | (frame.data[2 * i + 1] << 8u));
+        HostSim_CANFrame_t reply = {FIRST_ADDR + i, CAN_ID_STD, CAN_RTR_DATA, 8, {0xA1, 30, 0, 0, 0, 0, 0, 0}};
+        HostSim::CAN_Inject(BUS, reply);
+    }
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    HostSim::CAN_SetTxHook(BUS, OnFrame);
+
+    static CAN_GroupAgent<BUS> group(GROUP_ADDR);
+    static auto controllers = CreateControllers<PID, MOTOR_COUNT>(PID_Param_t{1, 0, 0, 0, 500});
+    static Motor4010<BUS> motor1({Motor_Ctrl_Type_e::Torque, Motor_Ctrl_Type_e::Speed}, controllers[0], 0x141, group);
+    static Motor4010<BUS> motor2({Motor_Ctrl_Type_e::Torque, Motor_Ctrl_Type_e::Speed}, controllers[1], 0x142, group);
+    static Motor4010<BUS> motor3({Motor_Ctrl_Type_e::Torque, Motor_Ctrl_Type_e::Speed}, controllers[2], 0x143, group);
+    static Motor4010<BUS> motor4({Motor_Ctrl_Type_e::Torque, Motor_Ctrl_Type_e::Speed}, controllers[3], 0x144, group);
+    bool ok = true;
+
+    // 全部电机写入时，新的目标在同一周期的分组指令中发出
+    HostSim::Run(5);
+    motor1.SetTargetSpeed(100);
+    HostSim::Tick();
+    printf("all members writing: slot 0 = %d in the same tick\n", slots[0]);
+    ok &= slots[0] == 100;
+
+    // 第4台电机停止写入，其余电机的指令仍每周期发出一帧
+    motor4.SetDivisionFactor(100000);
+    HostSim::Run(5);
+    uint32_t frames = groupFrames;
+    motor1.SetTargetSpeed(200);
+    motor2.SetTargetSpeed(-50);
+    HostSim::Tick();
+    printf("one member stopped: slots %d %d %d %d, frames in the tick %u\n", slots[0], slots[1], slots[2], slots[3],
+           groupFrames - frames);
+    ok &= slots[0] == 200 && slots[1] == -50 && slots[3] == 0 && groupFrames - frames == 1;
+
+    frames = groupFrames;
+    HostSim::Run(20);
+    printf("frames over 20 ticks: %u\n", groupFrames - frames);
+    ok &= groupFrames - frames == 20;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+#include <vector>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Bus/CAN_Base.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * CAN发送队列满时的取舍测试：同一标识符的一次性帧（如配置写入或多帧序列）不得被覆盖或丢弃，
+ * 队列满时只移除最新值模式的帧，且最新值模式的帧不能挤掉优先级更高的帧
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 1;
+constexpr uint32_t SEQUENCE_ADDR = 0x300;       // 一次性帧，数据为序号
+constexpr uint32_t CONTROL_ADDR = 0x201;        // 最新值模式的控制指令，0x201~0x200+CONTROLS
+constexpr size_t MAILBOXES = 3;
+constexpr size_t CONTROLS = 9;
+constexpr size_t SEQUENCE = MAILBOXES + CAN_TX_QUEUE_SIZE - CONTROLS;
+
+std::vector<uint8_t> sequence;
+std::vector<uint32_t> controls;
+
+void OnFrame(const HostSim_CANFrame_t &frame) {
+    if (frame.id == SEQUENCE_ADDR) {
+        sequence.push_back(frame.data[0]);
+    } else {
+        controls.push_back(frame.id);
+    }
+}
+
+CAN_Package_t Package(uint32_t addr, uint8_t data) {
+    return {1, CAN_ID_STD, CAN_RTR_DATA, addr, {data}, CAN_Priority_e::Normal};
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    HostSim::CAN_SetTxHook(BUS, OnFrame);
+    CAN_Base<BUS> &can = CAN_Base<BUS>::GetInstance();
+    const CAN_Stats_t &stats = can.GetStats();
+    bool ok = true;
+
+    // 仿真时间不推进，前3帧进入邮箱，其余填满发送队列
+    uint8_t next = 0;
+    for (size_t i = 0; i < SEQUENCE; ++i) {
+        ok &= can.Transmit(Package(SEQUENCE_ADDR, next++));
+    }
+    for (size_t i = 0; i < CONTROLS; ++i) {
+        ok &= can.TransmitLatest(Package(CONTROL_ADDR + i, 0));
+    }
+
+    // 队列已满：一次性帧移除优先级最低的最新值模式帧；同一标识符的最新值模式帧原位覆盖；
+    // 优先级低于队列中全部最新值模式帧的最新值模式帧被拒绝
+    bool oneShotAccepted = can.Transmit(Package(SEQUENCE_ADDR, next++));
+    bool replaced = can.TransmitLatest(Package(CONTROL_ADDR, 1));
+    bool lowerRejected = !can.TransmitLatest(Package(CONTROL_ADDR + CONTROLS, 0));
+    printf("queue full: one-shot accepted %d, latest replaced %d, lower-priority latest rejected %d\n",
+           oneShotAccepted, replaced, lowerRejected);
+    ok &= oneShotAccepted && replaced && lowerRejected;
+    ok &= stats.txEvicted == 1 && stats.txReplaced == 1 && stats.txDropped == 1;
+
+    // 一次性帧依次移除其余的最新值模式帧，队列中只剩一次性帧时新的一次性帧被拒绝，已排队的帧不受影响
+    for (size_t i = 0; i < CONTROLS - 1; ++i) {
+        ok &= can.Transmit(Package(SEQUENCE_ADDR, next++));
+    }
+    bool fullRejected = !can.Transmit(Package(SEQUENCE_ADDR, 0xFF));
+    printf("queue full of one-shot frames: new one-shot rejected %d\n", fullRejected);
+    ok &= fullRejected;
+
+    HostSim::Run(10);
+    bool inOrder = sequence.size() == next;
+    for (size_t i = 0; inOrder && i < sequence.size(); ++i) {
+        inOrder = sequence[i] == i;
+    }
+    printf("one-shot frames sent %zu of %u, in order %d; latest frames sent %zu\n", sequence.size(), next, inOrder,
+           controls.size());
+    ok &= inOrder && controls.empty() && stats.txEvicted == CONTROLS;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <csignal>
+#include <cstdio>
+#include <sys/time.h>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Bus/CAN_Base.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * CAN接收槽的测试
+ * @note 以POSIX信号模拟中断抢占：信号处理函数作为接收中断、每次连续写入两帧时，主循环读取的快照不得撕裂；
+ *       信号处理函数作为读者抢占写入过程时，读取不得自旋且快照同样完整
+ * @note 经HostSim注入帧时，CAN_Agent::Read返回自上次读取后收到的帧数与最近一帧
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 1;
+constexpr uint32_t ADDR = 0x2A0;
+constexpr uint32_t SIGNALS = 3000;
+constexpr long PERIOD_US = 20;
+
+CAN_RxSlot slot;
+volatile sig_atomic_t inside = 0;       // 主循环正处于读取或写入过程中
+volatile uint32_t signals = 0;
+volatile uint32_t interrupted = 0;      // 在读取或写入过程中到达的信号数
+volatile uint32_t torn = 0;
+volatile uint32_t lastSeq = 0;
+
+/**
+ * 第k帧的DLC为1+k%8，数据均为k的低字节，时间戳为k
+ */
+void WriteNext() {
+    uint32_t k = slot.GetSeq() + 1;
+    uint8_t data[8];
+    for (uint8_t &byte: data) {
+        byte = static_cast<uint8_t>(k);
+    }
+    slot.Write(data, 1 + k % 8, k);
+}
+
+bool Consistent(const CAN_RxFrame_t &frame, uint32_t seq) {
+    if (frame.seq != seq || frame.timestamp != seq || frame.DLC != 1 + seq % 8) {
+        return false;
+    }
+    for (uint8_t i = 0; i < 8; ++i) {
+        if (frame.data[i] != (i < frame.DLC ? static_cast<uint8_t>(seq) : 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Check() {
+    CAN_RxFrame_t frame;
+    uint32_t seq = slot.Read(frame);
+    if (!Consistent(frame, seq) || seq < lastSeq) {
+        torn = torn + 1;
+    }
+    lastSeq = seq;
+}
+
+void OnWriterSignal(int) {
+    signals = signals + 1;
+    interrupted = interrupted + (inside ? 1 : 0);
+    WriteNext();
+    WriteNext();
+}
+
+void OnReaderSignal(int) {
+    signals = signals + 1;
+    interrupted = interrupted + (inside ? 1 : 0);
+    Check();
+}
+
+/**
+ * 以handler作为中断，主循环执行body直到收到SIGNALS次信号
+ */
+template<typename F>
+void Preempt(void (*handler)(int), F body) {
+    signals = 0;
+    interrupted = 0;
+    torn = 0;
+    struct sigaction action = {};
+    action.sa_handler = handler;
+    sigaction(SIGALRM, &action, nullptr);
+    itimerval timer = {{0, PERIOD_US}, {0, PERIOD_US}};
+    setitimer(ITIMER_REAL, &timer, nullptr);
+    while (signals < SIGNALS) {
+        inside = 1;
+        body();
+        inside = 0;
+    }
+    timer = {};
+    setitimer(ITIMER_REAL, &timer, nullptr);
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    bool ok = true;
+
+    // 经总线收到的帧：Read返回新帧数与最近一帧，无新帧时保留上一帧
+    static CAN_Agent<BUS> agent(ADDR);
+    CAN_RxFrame_t frame;
+    bool empty = agent.Read(frame) == 0 && agent.GetRxAge() == UINT32_MAX;
+    HostSim::CAN_Inject(BUS, {ADDR, CAN_ID_STD, CAN_RTR_DATA, 2, {1, 2}});
+    bool first = agent.Read(frame) == 1 && frame.DLC == 2 && frame.data[1] == 2;
+    bool stale = agent.Read(frame) == 0 && frame.data[1] == 2;
+    HostSim::CAN_Inject(BUS, {ADDR, CAN_ID_STD, CAN_RTR_DATA, 8, {3, 3, 3, 3, 3, 3, 3, 3}});
+    HostSim::CAN_Inject(BUS, {ADDR, CAN_ID_STD, CAN_RTR_DATA, 4, {4, 4, 4, 4}});
+    HostSim::Run(5);
+    bool latest = agent.Read(frame) == 2 && frame.DLC == 4 && frame.data[3] == 4 && frame.data[4] == 0;
+    printf("agent: empty %d, first %d, stale %d, latest of two %d, count %u, age %u\n", empty, first, stale, latest,
+           agent.GetRxCount(), agent.GetRxAge());
+    ok &= empty && first && stale && latest && agent.GetRxCount() == 3 && agent.GetRxAge() == 5;
+
+    // 写者抢占读者，每次抢占连续写入两帧，读者读取的那一半可能被覆盖
+    WriteNext();
+    lastSeq = 0;
+    uint32_t reads = 0;
+    Preempt(OnWriterSignal, [&reads] {
+        Check();
+        reads++;
+    });
+    printf("writer preempts reader: %u signals, %u during a read, %u reads, torn %u\n", signals, interrupted, reads,
+           torn);
+    ok &= interrupted > 0 && torn == 0;
+
+    // 读者抢占写者，读取不会等待写者完成
+    lastSeq = 0;
+    uint32_t writes = 0;
+    Preempt(OnReaderSignal, [&writes] {
+        WriteNext();
+        writes++;
+    });
+    printf("reader preempts writer: %u signals, %u during a write, %u writes, torn %u\n", signals, interrupted,
+           writes, torn);
+    ok &= interrupted > 0 && torn == 0;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "DeviceBase.h"
+#include "ProjectConfig.h"
+
+/**
+ * 设备调度的主机基准：对比时间轮调度与原先逐周期反向遍历std::list的实现
+ * @note 设备组成参照16电机舵轮底盘，两种实现执行相同的设备集合，并校验各设备的执行次数一致
+ * @note 时间轮一侧还包含框架自身注册的设备，其耗时计入时间轮，结果偏保守
+ */
+
+namespace {
+
+constexpr uint32_t TICKS = 200000;  // 各分频系数的公倍数，保证两种实现的执行次数可比
+
+struct Load_t {
+    uint32_t divisionFactor;
+    uint32_t count;
+};
+
+constexpr Load_t LOADS[] = {{1, 16}, {2, 4}, {5, 4}, {10, 4}, {50, 4}};
+
+volatile uint32_t sink = 0;
+
+/**
+ * 原先的设备注册表，DevicesHandle与原实现相同，逐周期反向遍历全部设备并累加计数
+ */
+class ListDevice {
+public:
+    explicit ListDevice(uint32_t divisionFactor) : divisionFactor(divisionFactor) {
+        GetList().push_back(this);
+    }
+
+    static std::list<ListDevice *> &GetList() {
+        static std::list<ListDevice *> deviceList;
+        return deviceList;
+    }
+
+    static void DevicesHandle() {
+        static uint32_t stamp = HAL_GetTick();
+        static uint32_t cnt = 0;
+        uint32_t diff = HAL_GetTick() - stamp;
+        cnt++;
+        if (diff >= 1000) {
+            baseFre = cnt;
+            stamp = HAL_GetTick();
+            cnt = 0;
+        }
+        for (auto rit = GetList().rbegin(); rit != GetList().rend(); ++rit) {
+            ListDevice *devicePtr = *rit;
+            if (++(devicePtr->cnt) >= devicePtr->divisionFactor) {
+                devicePtr->Handle();
+                devicePtr->cnt = 0;
+            }
+        }
+    }
+
+    virtual void Handle() {
+        handled++;
+        sink = sink + 1;
+    }
+
+    virtual ~ListDevice() = default;
+
+    static uint32_t baseFre;
+    uint32_t handled = 0;
+
+private:
+    uint32_t divisionFactor;
+    uint32_t cnt = 0;
+};
+
+uint32_t ListDevice::baseFre = 0;
+
+class WheelDevice : public DeviceBase {
+public:
+    explicit WheelDevice(uint32_t divisionFactor) {
+        SetDivisionFactor(divisionFactor);
+    }
+
+    void Handle() override {
+        handled++;
+        sink = sink + 1;
+    }
+
+    uint32_t handled = 0;
+};
+
+/**
+ * 按整批计时，避免计时本身的开销
+ */
+template<typename F>
+double Measure(F handle) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < TICKS; ++i) {
+        handle();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / TICKS;
+}
+
+}
+
+int main() {
+    std::vector<std::unique_ptr<ListDevice>> listDevices;
+    std::vector<std::unique_ptr<WheelDevice>> wheelDevices;
+    std::vector<std::unique_ptr<uint8_t[]>> scatter;
+    for (const Load_t &load: LOADS) {
+        for (uint32_t i = 0; i < load.count; ++i) {
+            listDevices.emplace_back(new ListDevice(load.divisionFactor));
+            wheelDevices.emplace_back(new WheelDevice(load.divisionFactor));
+            // 模拟启动阶段穿插的其他堆分配，使链表节点与目标板上一样分散
+            scatter.emplace_back(new uint8_t[48 + 16 * (i % 4)]);
+        }
+    }
+
+    double list = Measure(ListDevice::DevicesHandle);
+    double wheel = Measure(DeviceBase::DevicesHandle);
+
+    bool ok = true;
+    uint64_t handled = 0;
+    for (size_t i = 0; i < listDevices.size(); ++i) {
+        handled += wheelDevices[i]->handled;
+        if (listDevices[i]->handled != wheelDevices[i]->handled) {
+            printf("device %zu: list %u, wheel %u handles\n", i, listDevices[i]->handled, wheelDevices[i]->handled);
+            ok = false;
+        }
+    }
+
+    // 原实现每周期访问全部设备，时间轮只访问本周期到期的设备；时间轮的访问数由调度器逐周期统计，
+    // 包含框架自身注册的设备，不计入计时
+    uint64_t visited = 0;
+    for (uint32_t i = 0; i < TICKS; ++i) {
+        DeviceBase::DevicesHandle();
+        visited += DeviceBase::GetTickLoad().last;
+    }
+    printf("devices: list %zu, wheel %zu (incl. framework devices), ticks %u\n", listDevices.size(),
+           DeviceBase::GetDeviceCount(), TICKS);
+    printf("std::list: %.1f ns/tick, %zu devices visited/tick\n", list, listDevices.size());
+    printf("wheel:     %.1f ns/tick, %.1f devices visited/tick (%.1f bench-device handles), peak load %u\n", wheel,
+           static_cast<double>(visited) / TICKS, static_cast<double>(handled) / TICKS,
+           DeviceBase::GetTickLoad().peak);
+    return ok ? 0 : 1;
+}
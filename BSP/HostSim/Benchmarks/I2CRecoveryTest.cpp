@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Bus/I2C_Base.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * I2C总线恢复测试：从机在读传输中途拉低SDA，检查超时后补发时钟释放总线，且HAL启动函数从不在总线忙或屏蔽中断时调用
+ * @note 第二轮中从机需要多次恢复才释放，恢复后总线仍被占用的事务应直接失败，后续请求再次恢复直至总线释放
+ * @note 同一代理的单次读取与批量读取交错时，单次读取的完成不应解除批次占用
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 1;
+constexpr uint8_t ADDR = 0x68;
+constexpr uint8_t REG_SINGLE = 0x10;
+constexpr uint8_t REG_BATCH = 0x20;
+
+uint32_t stallsLeft = 0;
+uint32_t completed = 0, failed = 0;
+bool batchClearedEarly = false;
+
+I2C_Agent<BUS> *agentPtr = nullptr;
+
+HostSim_I2CResponse_e Device(HostSim_I2CTransfer_t &transfer) {
+    if (transfer.addr != ADDR) {
+        return HostSim_I2CResponse_e::Nack;
+    }
+    if (stallsLeft > 0) {
+        stallsLeft--;
+        return HostSim_I2CResponse_e::Stall;
+    }
+    for (uint16_t i = 0; i < transfer.size; ++i) {
+        transfer.data[i] = transfer.reg + i;
+    }
+    return HostSim_I2CResponse_e::Ack;
+}
+
+void OnComplete(uint8_t reg, uint8_t *data, uint16_t size, bool ok) {
+    ok ? completed++ : failed++;
+    if (reg == REG_SINGLE && !agentPtr->IsBatchPending()) {
+        batchClearedEarly = true;
+    }
+}
+
+/**
+ * 每毫秒发出一次单次读取，直到成功完成target次或超过limit毫秒
+ */
+bool Poll(I2C_Agent<BUS> &agent, uint32_t target, uint32_t limit) {
+    static uint8_t data[4];
+    uint32_t start = completed;
+    for (uint32_t i = 0; i < limit && completed - start < target; ++i) {
+        if (I2C_Base<BUS>::GetInstance().GetQueueSize() == 0) {
+            agent.MemRead(0x00, data, sizeof(data));
+        }
+        HostSim::Tick();
+    }
+    return completed - start >= target;
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    HostSim::I2C_SetDevice(BUS, Device);
+
+    I2C_Agent<BUS> agent(ADDR, OnComplete);
+    agentPtr = &agent;
+    const HostSim_I2CStats_t &simStats = HostSim::I2C_GetStats(BUS);
+    const I2C_Stats_t &busStats = I2C_Base<BUS>::GetInstance().GetStats();
+    bool ok = true;
+
+    // 从机在收到HOSTSIM_I2C_STALL_CLOCKS个时钟后释放，一次恢复即可
+    stallsLeft = 1;
+    ok &= Poll(agent, 10, 100);
+    printf("stall released by %u clocks: recoveries %u, timeouts %u, lockups %u, completed %u\n", simStats.recoveryClocks,
+           busStats.recoveries, busStats.timeouts, busStats.lockups, completed);
+    ok &= busStats.timeouts == 1 && busStats.recoveries == 1 && busStats.lockups == 0;
+
+    // 从机需要30个时钟，每次恢复产生10个：超时后的恢复与下一条请求启动前的恢复之后总线仍被占用，该请求不经HAL直接失败，
+    // 再下一条请求启动前的第三次恢复释放总线
+    HostSim::I2C_SetStallClocks(BUS, 30);
+    stallsLeft = 1;
+    uint32_t recoveries = busStats.recoveries;
+    ok &= Poll(agent, 10, 100);
+    printf("stall released after %u recoveries, lockups %u\n", busStats.recoveries - recoveries, busStats.lockups);
+    ok &= busStats.recoveries - recoveries == 3 && busStats.lockups == 1;
+
+    // 单次读取先于批量读取入队并先完成，批次占用应保持到批量读取完成
+    static uint8_t single[2], burst[2][2];
+    I2C_BurstRead_t reads[2] = {{REG_BATCH, burst[0], 2}, {REG_BATCH + 2, burst[1], 2}};
+    agent.MemRead(REG_SINGLE, single, sizeof(single));
+    agent.MemReadBatch(reads, 2);
+    for (uint32_t i = 0; i < 10 && agent.IsBatchPending(); ++i) {
+        HostSim::Tick();
+    }
+    printf("batch: cleared early %d, pending %d, burst %02x %02x\n", batchClearedEarly, agent.IsBatchPending(),
+           burst[0][0], burst[1][0]);
+    ok &= !batchClearedEarly && !agent.IsBatchPending() && burst[1][0] == REG_BATCH + 2;
+
+    printf("HAL starts with BUSY set %u, with interrupts masked %u\n", simStats.busyStarts, simStats.maskedStarts);
+    ok &= simStats.busyStarts == 0 && simStats.maskedStarts == 0;
+    return ok ? 0 : 1;
+}
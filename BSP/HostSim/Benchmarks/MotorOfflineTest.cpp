@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Motors/Motor4010.hpp"
+#include "Control/PID.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * 电机掉线判定测试：同一总线上两台Motor4010速度闭环，一台每条指令都有应答，另一台从未发出反馈
+ * @note 从未反馈的电机应在开始控制后的掉线判定时间内转入Offline，此后发出的转矩指令为零，且不再接受新的目标值；
+ *       有应答的电机保持Online；之后从未反馈的电机开始应答，应重新上线
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 1;
+constexpr uint32_t SILENT_ADDR = 0x141;
+constexpr uint32_t ANSWERING_ADDR = 0x142;
+constexpr uint32_t TIMEOUT_TICKS = MOTOR_OFFLINE_PERIODS + 2;     // 分频系数为1时反馈周期为1ms
+
+bool silentAnswers = false;
+int16_t lastSilentTorque = 0;
+uint32_t silentCommands = 0;
+
+/**
+ * 总线上的其他节点：按指令的标识符应答，转矩指令原样回报为反馈
+ */
+void OnFrame(const HostSim_CANFrame_t &frame) {
+    if (frame.id == SILENT_ADDR) {
+        silentCommands++;
+        lastSilentTorque = static_cast<int16_t>(frame.data[4] | (frame.data[5] << 8u));
+        if (!silentAnswers) {
+            return;
+        }
+    }
+    if (frame.id != SILENT_ADDR && frame.id != ANSWERING_ADDR) {
+        return;
+    }
+    HostSim_CANFrame_t reply = {frame.id, CAN_ID_STD, CAN_RTR_DATA, 8, {0xA1, 30, 0, 0, 0, 0, 0, 0}};
+    HostSim::CAN_Inject(BUS, reply);
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    HostSim::CAN_SetTxHook(BUS, OnFrame);
+
+    static auto controllers = CreateControllers<PID, 2>(PID_Param_t{1, 0, 0, 100, 100});
+    static Motor4010<BUS> silent({Motor_Ctrl_Type_e::Torque, Motor_Ctrl_Type_e::Speed}, controllers[0], SILENT_ADDR);
+    static Motor4010<BUS> answering({Motor_Ctrl_Type_e::Torque, Motor_Ctrl_Type_e::Speed}, controllers[1],
+                                    ANSWERING_ADDR);
+    silent.SetTargetSpeed(50);
+    answering.SetTargetSpeed(50);
+    bool ok = true;
+
+    // 开始控制后尚未超时，从未反馈的电机仍以目标值闭环
+    HostSim::Run(MOTOR_OFFLINE_PERIODS / 2);
+    printf("before timeout: silent link %u, torque %d\n", static_cast<unsigned>(silent.GetHealth().link),
+           lastSilentTorque);
+    ok &= silent.GetHealth().link == Motor_Link_e::Unknown && lastSilentTorque != 0;
+
+    HostSim::Run(TIMEOUT_TICKS);
+    uint32_t commands = silentCommands;
+    HostSim::Run(20);
+    silent.SetTargetSpeed(80);
+    HostSim::Run(5);
+    printf("no feedback: silent link %u, offline count %u, torque %d over %u commands; answering link %u\n",
+           static_cast<unsigned>(silent.GetHealth().link), silent.GetHealth().offlineCount, lastSilentTorque,
+           silentCommands - commands, static_cast<unsigned>(answering.GetHealth().link));
+    ok &= silent.GetHealth().link == Motor_Link_e::Offline && silent.GetHealth().offlineCount == 1;
+    ok &= silentCommands > commands && lastSilentTorque == 0 && controllers[0].GetOutput() == 0;
+    ok &= answering.GetHealth().link == Motor_Link_e::Online;
+
+    // 从未反馈的电机开始应答后重新上线
+    silentAnswers = true;
+    HostSim::Run(5);
+    printf("after the first feedback: silent link %u\n", static_cast<unsigned>(silent.GetHealth().link));
+    ok &= silent.GetHealth().link == Motor_Link_e::Online;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "DeviceBase.h"
+#include "Control/Clamp.hpp"
+#include "Control/PID.hpp"
+#include "Control/PIDBank.hpp"
+
+/**
+ * PIDBank的主机基准：对比N个PID逐个计算与PIDBank一次计算N路的耗时，两者均经ControllerCalc函数指针调用，与电机中相同
+ * @note 先校验相同输入下PIDBank的结果与PID完全一致；再以设备调度运行，反馈在周期开始前更新，
+ *       校验各成员设备在同一周期内得到的控制量与逐个计算的PID相同，没有滞后
+ */
+
+namespace {
+
+constexpr size_t N = 16;
+constexpr size_t DEVICE_LOOPS = 4;
+constexpr uint32_t TICKS = 2000;
+constexpr uint32_t REPEAT = 1000000;
+constexpr PID_Param_t PARAMS = {0.23f, 0.008f, 0.3f, 2000, 2000};
+
+using Calc_t = const float &(*)(ControllerBase &);
+
+float target[N], feedback[N];
+float sensor[DEVICE_LOOPS];     // 相当于在接收中断中更新的反馈
+
+float Signal(uint32_t tick, size_t i) {
+    return 1500 * std::sin(0.01f * static_cast<float>(tick) + static_cast<float>(i));
+}
+
+/**
+ * 模拟电机：读取本周期的控制量
+ */
+class LoopDevice : public DeviceBase {
+public:
+    LoopDevice(ControllerBase &controller, size_t index) : controller(controller), index(index) {}
+
+    void Handle() override {
+        output = ControllerCalc<PIDBank<DEVICE_LOOPS>::Loop>(controller);
+    }
+
+    ControllerBase &controller;
+    size_t index;
+    float output = 0;
+};
+
+template<typename F>
+double Measure(F step) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t k = 0; k < REPEAT; ++k) {
+        feedback[k % N] += 0.001f;
+        step();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / REPEAT;
+}
+
+}
+
+int main() {
+    auto pids = CreateControllers<PID, N>(PARAMS);
+    static PIDBank<N> bank(PARAMS);
+    for (size_t i = 0; i < N; ++i) {
+        target[i] = 100.f + static_cast<float>(i);
+        pids[i].SetTarget(&target[i]);
+        pids[i].SetFeedback({&feedback[i]});
+        bank[i].SetTarget(&target[i]);
+        bank[i].SetFeedback({&feedback[i]});
+    }
+
+    // 相同输入下逐路比较，包含积分与输出限幅饱和的区间
+    Calc_t pidCalc = &ControllerCalc<PID>;
+    Calc_t loopCalc = &ControllerCalc<PIDBank<N>::Loop>;
+    float maxDiff = 0;
+    for (uint32_t k = 0; k < TICKS; ++k) {
+        for (size_t i = 0; i < N; ++i) {
+            feedback[i] = Signal(k, i);
+        }
+        for (size_t i = 0; i < N; ++i) {
+            maxDiff = std::fmax(maxDiff, std::fabs(pidCalc(pids[i]) - loopCalc(bank[i])));
+        }
+    }
+
+    // 以设备调度运行，成员按注册顺序逆序计算，第一个计算的成员执行批量计算
+    static float deviceTarget[DEVICE_LOOPS] = {};
+    static PIDBank<DEVICE_LOOPS> deviceBank(PARAMS);
+    static auto reference = CreateControllers<PID, DEVICE_LOOPS>(PARAMS);
+    static LoopDevice *devices[DEVICE_LOOPS];
+    for (size_t i = 0; i < DEVICE_LOOPS; ++i) {
+        devices[i] = new LoopDevice(deviceBank[i], i);
+        deviceBank[i].SetTarget(&deviceTarget[i]);
+        deviceBank[i].SetFeedback({&sensor[i]});
+        reference[i].SetTarget(&deviceTarget[i]);
+        reference[i].SetFeedback({&sensor[i]});
+    }
+    float tickDiff = 0;
+    for (uint32_t k = 0; k < TICKS; ++k) {
+        for (size_t i = 0; i < DEVICE_LOOPS; ++i) {
+            sensor[i] = Signal(k, i);
+        }
+        DeviceBase::DevicesHandle();
+        for (size_t i = 0; i < DEVICE_LOOPS; ++i) {
+            tickDiff = std::fmax(tickDiff, std::fabs(devices[i]->output - reference[i].Calc()));
+        }
+    }
+
+    volatile float sink = 0;
+    double pidNs = Measure([&] {
+        for (size_t i = 0; i < N; ++i) {
+            sink = pidCalc(pids[i]);
+        }
+    });
+    double bankNs = Measure([&] {
+        for (size_t i = 0; i < N; ++i) {
+            sink = loopCalc(bank[i]);
+        }
+    });
+
+    printf("max |PID - PIDBank| over %u ticks: %g\n", TICKS, maxDiff);
+    printf("members scheduled as devices: max |PIDBank(t) - PID(t)| %g\n", tickDiff);
+    printf("N=%zu per tick: PID %.1f ns, PIDBank %.1f ns\n", N, pidNs, bankNs);
+    return maxDiff == 0 && tickDiff == 0 ? 0 : 1;
+}
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "Control/Clamp.hpp"
+#include "Control/PID.hpp"
+#include "Control/PIDEx.hpp"
+
+/**
+ * PIDEx的行为测试：不含任何功能时与PID逐步比较，并分别校验各项可选功能与注释所述一致
+ * @note 实测间隔使用可手动推进的计数源，调用间隔精确可控
+ */
+
+namespace {
+
+constexpr uint32_t STEPS = 2000;
+constexpr uint32_t REPEAT = 1000000;
+
+/**
+ * 手动推进的周期计数源，频率为1MHz
+ */
+struct ManualCycleSource {
+    static void Init() {}
+
+    static uint32_t Now() {
+        return now;
+    }
+
+    static uint32_t Frequency() {
+        return 1000000u;
+    }
+
+    static uint32_t now;
+};
+
+uint32_t ManualCycleSource::now = 0;
+
+constexpr uint32_t NOMINAL_CYCLES = 1000;   // 名义周期0.001s对应的计数
+
+float target = 0, feedback = 0;
+
+template<typename T>
+T &Bind(T &controller) {
+    controller.SetTarget(&target);
+    controller.SetFeedback({&feedback});
+    return controller;
+}
+
+float Signal(uint32_t k) {
+    return 1500 * std::sin(0.01f * static_cast<float>(k)) + 200 * std::sin(0.37f * static_cast<float>(k));
+}
+
+bool CheckPlain() {
+    static PID pid({0.23f, 0.008f, 0.3f, 2000, 1000});
+    static PIDEx<> pidEx({0.23f, 0.008f, 0.3f, 2000, 1000});
+    Bind(pid);
+    Bind(pidEx);
+    float maxDiff = 0;
+    for (uint32_t k = 0; k < STEPS; ++k) {
+        target = 1000 * std::sin(0.003f * static_cast<float>(k));
+        feedback = Signal(k);
+        maxDiff = std::fmax(maxDiff, std::fabs(pid.Calc() - pidEx.Calc()));
+    }
+
+    volatile float sink = 0;
+    auto measure = [&](ControllerBase &controller) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t k = 0; k < REPEAT; ++k) {
+            feedback = static_cast<float>(k & 1023u);
+            sink = controller.Calc();
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / REPEAT;
+    };
+    double pidNs = measure(pid);
+    double pidExNs = measure(pidEx);
+    printf("PIDEx<0> vs PID over %u steps: max diff %g; %.1f ns vs %.1f ns per Calc\n", STEPS, maxDiff, pidExNs, pidNs);
+    return maxDiff == 0;
+}
+
+/**
+ * 输出每个名义周期的变化量不超过slewRate
+ */
+bool CheckSlew() {
+    static PIDEx<PIDEX_SLEW_LIMIT> controller({1, 0, 0, 0, 100, 0, 0, 0, 0, 2.5f});
+    Bind(controller);
+    target = 80;
+    feedback = 0;
+    float last = 0, maxStep = 0;
+    uint32_t steps = 0;
+    while (controller.GetOutput() < 80 && steps < 100) {
+        float output = controller.Calc();
+        maxStep = std::fmax(maxStep, std::fabs(output - last));
+        last = output;
+        steps++;
+    }
+    printf("slew limit 2.5: max step %g, reached 80 after %u calls\n", maxStep, steps);
+    return maxStep == 2.5f && steps == 32;
+}
+
+/**
+ * 输出饱和且误差使其加深时不积分，误差反向后立即退出饱和；不启用时积分持续累积，长时间保持饱和
+ */
+bool CheckConditional() {
+    const PIDEx_Param_t params = {1, 0.1f, 0, 1e6f, 10};
+    static PIDEx<PIDEX_CONDITIONAL_INTEGRATION> conditional(params);
+    static PIDEx<> plain(params);
+    Bind(conditional);
+    Bind(plain);
+    target = 100;
+    feedback = 0;
+    for (uint32_t k = 0; k < 100; ++k) {
+        conditional.Calc();
+        plain.Calc();
+    }
+    feedback = 101;
+    float conditionalOut = conditional.Calc();
+    float plainOut = plain.Calc();
+    printf("conditional integration: output after reversal %g, without it %g\n", conditionalOut, plainOut);
+    return std::fabs(conditionalOut + 1.1f) < 1e-6f && plainOut == 10;
+}
+
+/**
+ * 反算将积分回调至输出刚好饱和的位置，误差反向后立即退出饱和；kb=1时积分稳定于0，反向后的输出为-1.1
+ */
+bool CheckBackCalculation() {
+    static PIDEx<PIDEX_BACK_CALCULATION> controller({1, 0.1f, 0, 1e6f, 10, 0, 1});
+    Bind(controller);
+    target = 100;
+    feedback = 0;
+    for (uint32_t k = 0; k < 200; ++k) {
+        controller.Calc();
+    }
+    feedback = 101;
+    float output = controller.Calc();
+    printf("back-calculation: output after reversal %g\n", output);
+    return std::fabs(output) < 10 && std::fabs(output + 1.1f) < 1e-4f;
+}
+
+bool Near(float value, float expected) {
+    return std::fabs(value - expected) <= 1e-5f * std::fmax(1.f, std::fabs(expected));
+}
+
+/**
+ * 调用间隔为名义周期的k倍时，积分增量乘以k、微分除以k；名义周期0.001s与计数频率之积存在舍入，按相对误差比较
+ */
+bool CheckMeasuredDt() {
+    static PIDEx<PIDEX_MEASURED_DT, ManualCycleSource> integral({0, 1, 0, 1e6f, 1e6f});
+    static PIDEx<PIDEX_MEASURED_DT, ManualCycleSource> derivative({0, 0, 1, 1e6f, 1e6f});
+    Bind(integral);
+    Bind(derivative);
+    target = 3;
+    feedback = 0;
+    // 首次调用没有间隔，按名义周期计
+    integral.Calc();
+    derivative.Calc();
+    bool ok = true;
+    float expected = 3;
+    for (uint32_t k = 1; k <= 10; ++k) {
+        ManualCycleSource::now += 2 * NOMINAL_CYCLES;
+        target = 3 + 4.f * static_cast<float>(k);
+        expected += 2 * target;
+        integral.Calc();
+        ok &= Near(derivative.Calc(), 2);
+    }
+    float integralOut = integral.GetOutput();
+    float derivativeOut = derivative.GetOutput();
+
+    // 间隔超出10倍名义周期时按10倍计
+    ManualCycleSource::now += 50 * NOMINAL_CYCLES;
+    target += 40;
+    float clamped = derivative.Calc();
+    printf("measured dt at 2 periods: integral %g (expected %g), derivative %g; at 50 periods derivative %g\n",
+           integralOut, expected, derivativeOut, clamped);
+    return ok && Near(integralOut, expected) && Near(clamped, 4);
+}
+
+}
+
+int main() {
+    bool ok = CheckPlain();
+    ok &= CheckSlew();
+    ok &= CheckConditional();
+    ok &= CheckBackCalculation();
+    ok &= CheckMeasuredDt();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#include "Matrix/matrix.h"
+#include "Motors/Motor4010.hpp"
+#include "Control/ControlBase.hpp"
+#include "Chassis/POV_Chassis.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * POV_Chassis融合估计的数值等价性检验：以随机的目标速度与轮组状态，逐步对比单一共享估计与原先基于Matrixf、
+ * 各轮组分别保存估计与信息矩阵的分布式信息滤波，并统计两者ForwardKinematics的耗时
+ */
+
+namespace {
+
+constexpr size_t WHEELS = 4;
+constexpr uint32_t STEPS = 5000;
+constexpr float WHEEL_DIAMETER = 0.0483f;
+constexpr float LENGTH = 0.24f, WIDTH = 0.24f;
+constexpr float TOLERANCE = 1e-4f;
+
+/**
+ * 原先的ForwardKinematics，各轮组分别预测后取信息的平均值融合，并将融合结果写回各轮组
+ */
+class ReferenceEstimator {
+public:
+    explicit ReferenceEstimator(const std::array<Swerve_t, WHEELS> &modules) : modules(modules) {
+        for (size_t i = 0; i < WHEELS; ++i) {
+            float hnData[2 * 3] = {1, 0, -modules[i].ly, 0, 1, modules[i].lx};
+            Hn[i] = Matrixf<2, 3>(hnData);
+            Jn[i] = matrixf::eye<3, 3>();
+            Xn[i] = matrixf::zeros<3, 1>();
+        }
+        float BData[2 * 2] = {100, 0, 0, 100};
+        B = Matrixf<2, 2>(BData);
+        float QData[3 * 3] = {0.1, 0, 0, 0, 0.1, 0, 0, 0, 0.1};
+        Q = Matrixf<3, 3>(QData);
+    }
+
+    void ForwardKinematics(std::array<float, 3> &targetV, std::array<float, 3> &estimatedV) {
+        std::array<Matrixf<3, 3>, WHEELS> Wn;
+        std::array<Matrixf<3, 1>, WHEELS> wn;
+        for (size_t i = 0; i < WHEELS; ++i) {
+            float angle = (modules[i].steerMotor->GetState().position + modules[i].zeroPosition) / 180.f * PI;
+            float speed = modules[i].driveMotor->GetState().speed / 360.f * PI * WHEEL_DIAMETER;
+            float velData[2] = {speed * cosf(angle), speed * sinf(angle)};
+            Matrixf<2, 1> vel(velData);
+            Xn[i] = alpha * Xn[i] + (1 - alpha) * Matrixf<3, 1>(targetV.data());
+            Jn[i] = matrixf::inv(alpha * alpha * matrixf::inv(Jn[i]) + 0.5 * Q);
+            Wn[i] = Jn[i] / WHEELS + Hn[i].trans() * B * Hn[i];
+            wn[i] = Jn[i] / WHEELS * Xn[i] + Hn[i].trans() * B * vel;
+        }
+
+        Matrixf<3, 3> W_mean = matrixf::zeros<3, 3>();
+        Matrixf<3, 1> w_mean = matrixf::zeros<3, 1>();
+        for (size_t i = 0; i < WHEELS; ++i) {
+            W_mean += Wn[i] / WHEELS;
+            w_mean += wn[i] / WHEELS;
+        }
+        for (size_t i = 0; i < WHEELS; ++i) {
+            Xn[i] = matrixf::inv(W_mean) * w_mean;
+            Jn[i] = WHEELS * W_mean;
+        }
+        estimatedV[0] = Xn[0][0][0];
+        estimatedV[1] = Xn[0][1][0];
+        estimatedV[2] = Xn[0][2][0];
+    }
+
+private:
+    std::array<Swerve_t, WHEELS> modules;
+    std::array<Matrixf<3, 3>, WHEELS> Jn;
+    std::array<Matrixf<2, 3>, WHEELS> Hn;
+    std::array<Matrixf<3, 1>, WHEELS> Xn;
+    Matrixf<3, 3> Q;
+    Matrixf<2, 2> B;
+    const float alpha = 0.5;
+};
+
+/**
+ * 取出POV_Chassis的目标速度与估计结果
+ */
+class ChassisProbe : public POV_Chassis<WHEELS> {
+public:
+    using POV_Chassis<WHEELS>::POV_Chassis;
+
+    std::array<float, 3> &TargetV() { return targetV; }
+
+    std::array<float, 3> &EstimatedV() { return estimatedV; }
+};
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+
+    auto controllers = CreateControllers<Amplifier<1>, 2 * WHEELS>();
+    static Motor4010<1> steer1({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[0], 0x141);
+    static Motor4010<1> drive1({Motor_Ctrl_Type_e::Speed, Motor_Ctrl_Type_e::Speed}, controllers[1], 0x142);
+    static Motor4010<1> steer2({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[2], 0x143);
+    static Motor4010<1> drive2({Motor_Ctrl_Type_e::Speed, Motor_Ctrl_Type_e::Speed}, controllers[3], 0x144);
+    static Motor4010<1> steer3({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[4], 0x145);
+    static Motor4010<1> drive3({Motor_Ctrl_Type_e::Speed, Motor_Ctrl_Type_e::Speed}, controllers[5], 0x146);
+    static Motor4010<1> steer4({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[6], 0x147);
+    static Motor4010<1> drive4({Motor_Ctrl_Type_e::Speed, Motor_Ctrl_Type_e::Speed}, controllers[7], 0x148);
+    std::array<Swerve_t, WHEELS> modules = {Swerve_t{&steer1, &drive1, LENGTH / 2, -WIDTH / 2, 180},
+                                            Swerve_t{&steer2, &drive2, LENGTH / 2, WIDTH / 2, 0},
+                                            Swerve_t{&steer3, &drive3, -LENGTH / 2, WIDTH / 2, 0},
+                                            Swerve_t{&steer4, &drive4, -LENGTH / 2, -WIDTH / 2, 180}};
+    Motor4010<1> *steers[WHEELS] = {&steer1, &steer2, &steer3, &steer4};
+    Motor4010<1> *drives[WHEELS] = {&drive1, &drive2, &drive3, &drive4};
+
+    static ChassisProbe chassis(WHEEL_DIAMETER, std::array<Swerve_t, WHEELS>(modules));
+    ReferenceEstimator reference(modules);
+    std::array<float, 3> referenceV = {};
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> uniform(-1, 1);
+    float maxDiff = 0;
+    double chassisNs = 0, referenceNs = 0;
+    for (uint32_t k = 0; k < STEPS; ++k) {
+        chassis.TargetV() = {uniform(generator), uniform(generator), 2 * uniform(generator)};
+        for (size_t i = 0; i < WHEELS; ++i) {
+            steers[i]->GetState().position = 180 * uniform(generator);
+            drives[i]->GetState().speed = 3000 * uniform(generator);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        reference.ForwardKinematics(chassis.TargetV(), referenceV);
+        auto middle = std::chrono::steady_clock::now();
+        chassis.ForwardKinematics();
+        auto end = std::chrono::steady_clock::now();
+        referenceNs += std::chrono::duration<double, std::nano>(middle - start).count();
+        chassisNs += std::chrono::duration<double, std::nano>(end - middle).count();
+
+        for (size_t i = 0; i < 3; ++i) {
+            maxDiff = std::fmax(maxDiff, std::fabs(chassis.EstimatedV()[i] - referenceV[i]));
+        }
+    }
+
+    printf("%u steps: max |POV_Chassis - reference| %.3g\n", STEPS, maxDiff);
+    printf("ForwardKinematics: reference Matrixf %.0f ns, POV_Chassis %.0f ns\n", referenceNs / STEPS,
+           chassisNs / STEPS);
+    return maxDiff < TOLERANCE ? 0 : 1;
+}
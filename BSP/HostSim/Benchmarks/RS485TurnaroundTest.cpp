@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Motors/Motor4315.hpp"
+#include "Control/ControlBase.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * RS485收发转换的时序测试：同一总线上5台Motor4315，虚拟从机在请求发送完成后立即应答
+ * @note 校验发送期间DE为高、应答到达时DE为低，且每个应答都在接收中断中立即提交了下一条请求，不等待控制周期
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 1;
+constexpr uint32_t TICKS = 2000;
+constexpr size_t MOTOR_COUNT = 5;
+
+bool DriverEnabled() {
+    return (BSP_RS485FlowCtrlPortList[BUS]->ODR & BSP_RS485FlowCtrlPinList[BUS]) != 0;
+}
+
+auto controllers = CreateControllers<Amplifier<1>, MOTOR_COUNT>();
+Motor4315<BUS> motor1({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[0], 1);
+Motor4315<BUS> motor2({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[1], 2);
+Motor4315<BUS> motor3({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[2], 3);
+Motor4315<BUS> motor4({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[3], 4);
+Motor4315<BUS> motor5({Motor_Ctrl_Type_e::Position, Motor_Ctrl_Type_e::Position}, controllers[4], 5);
+
+uint8_t response[15] = {};
+bool responsePending = false;
+uint32_t requests = 0, requestsWithoutDE = 0;
+
+/**
+ * 虚拟从机，按请求中的ID生成位置应答，在请求发送完成之后注入
+ */
+void OnRequest(const uint8_t *data, size_t size) {
+    requests++;
+    if (!DriverEnabled()) {
+        requestsWithoutDE++;
+    }
+    if (size != 11 || data[3] != 0x55) {
+        return;
+    }
+    response[0] = 0x3C;
+    response[1] = 0x00;
+    response[2] = data[2];
+    response[3] = 0x55;
+    for (size_t i = 4; i < 13; ++i) {
+        response[i] = 0;
+    }
+    uint16_t crc16 = CRC16Calc(response, 13);
+    response[13] = crc16;
+    response[14] = crc16 >> 8u;
+    responsePending = true;
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    HostSim::UART_SetTxHook(BSP_RS485UARTIndexList[BUS], OnRequest);
+    // 各电机每周期都提交请求，使总线上始终有等待发出的请求
+    for (Motor4315<BUS> *motor: {&motor1, &motor2, &motor3, &motor4, &motor5}) {
+        motor->SetDivisionFactor(1);
+    }
+
+    uint32_t responses = 0, responsesWithDE = 0, immediate = 0;
+    for (uint32_t i = 0; i < TICKS; ++i) {
+        HostSim::Tick();
+        if (!responsePending) {
+            continue;
+        }
+        responsePending = false;
+        responses++;
+        if (DriverEnabled()) {
+            responsesWithDE++;
+        }
+        uint32_t before = RS485_Base<BUS>::GetInstance().GetBusStats().turnarounds;
+        HostSim::UART_Inject(BSP_RS485UARTIndexList[BUS], response, sizeof(response));
+        // 下一条请求在应答的接收中断中提交，返回时DE应已置高
+        if (RS485_Base<BUS>::GetInstance().GetBusStats().turnarounds != before && DriverEnabled()) {
+            immediate++;
+        }
+    }
+
+    const RS485_BusStats_t &busStats = RS485_Base<BUS>::GetInstance().GetBusStats();
+    printf("ticks %u: requests %u (DE low %u), responses %u (DE high %u)\n", TICKS, requests, requestsWithoutDE,
+           responses, responsesWithDE);
+    printf("turnarounds %u, committed within the response interrupt %u, max %u us\n", busStats.turnarounds, immediate,
+           busStats.maxTurnaroundUs);
+
+    // 总线始终饱和，除最后一个应答外每个应答之后都应立即发出下一条请求
+    bool ok = requests > 0 && requestsWithoutDE == 0 && responsesWithDE == 0 && immediate == busStats.turnarounds &&
+              busStats.turnarounds + 1 >= responses;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+#include <vector>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Bus/SPI_Base.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * SPI传输队列的测试：三个从机共用SPI2，其中Flash使用与CubeMX不同的时钟配置
+ * @note 校验WriteRead的命令与数据在一次片选内完成、切换到配置不同的从机时先改写外设配置再拉低片选，
+ *       以及一段传输失败时丢弃同请求的剩余段并释放片选，后续请求不受影响
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 2;
+constexpr size_t FLASH = 0, GYRO = 1, ACCEL = 2, DEVICES = 3;
+constexpr uint16_t CS_PINS[DEVICES] = {GPIO_PIN_12, GPIO_PIN_13, GPIO_PIN_14};
+constexpr uint32_t CONFIG_MASK = SPI_CR1_BR | SPI_CR1_CPOL | SPI_CR1_CPHA;
+
+const SPI_Config_t FLASH_CONFIG = {SPI_BAUDRATEPRESCALER_8, SPI_POLARITY_LOW, SPI_PHASE_1EDGE};
+const SPI_Config_t DEFAULT_CONFIG = {SPI_BAUDRATEPRESCALER_128, SPI_POLARITY_HIGH, SPI_PHASE_2EDGE};
+
+/**
+ * 从机看到的一次片选，记录其间每次传输的长度
+ */
+struct Selection_t {
+    size_t device;
+    std::vector<uint16_t> sizes;
+};
+
+std::vector<Selection_t> selections;
+Selection_t current;
+bool selected = false;
+bool failAccel = true;
+uint32_t violations = 0;    // 传输时选中的从机不止一个或没有、或传输与片选时的外设配置不符
+
+uint32_t Expected(size_t device) {
+    const SPI_Config_t &config = device == FLASH ? FLASH_CONFIG : DEFAULT_CONFIG;
+    return config.prescaler | config.polarity | config.phase;
+}
+
+void OnPin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {
+    for (size_t i = 0; i < DEVICES; ++i) {
+        if (port != GPIOB || pin != CS_PINS[i]) {
+            continue;
+        }
+        if (state == GPIO_PIN_RESET) {
+            if (selected || (SPI2->CR1 & CONFIG_MASK) != Expected(i)) {
+                violations++;
+            }
+            selected = true;
+            current = {i, {}};
+        } else if (selected && current.device == i) {
+            selected = false;
+            selections.push_back(current);
+        }
+    }
+}
+
+/**
+ * Flash以0x03命令与3字节地址读出地址的低字节递增序列；陀螺仪与加速度计读出寄存器地址递增序列，
+ * 加速度计在失败标志置位时使命令段以错误结束
+ */
+void OnTransfer(HostSim_SPITransfer_t &transfer) {
+    size_t count = 0, device = DEVICES;
+    for (size_t i = 0; i < DEVICES; ++i) {
+        if ((GPIOB->ODR & CS_PINS[i]) == 0) {
+            count++;
+            device = i;
+        }
+    }
+    if (count != 1 || (transfer.CR1 & CONFIG_MASK) != Expected(device)) {
+        violations++;
+        return;
+    }
+    static uint8_t command[4];
+    if (current.sizes.empty()) {
+        for (size_t i = 0; i < transfer.size && i < sizeof(command); ++i) {
+            command[i] = transfer.tx[i];
+        }
+        if (device == ACCEL && failAccel) {
+            transfer.error = true;
+        }
+    } else if (transfer.rx != nullptr) {
+        uint8_t first = device == FLASH ? command[3] : static_cast<uint8_t>(command[0] & 0x7F);
+        for (uint16_t i = 0; i < transfer.size; ++i) {
+            transfer.rx[i] = static_cast<uint8_t>(first + i);
+        }
+    }
+    current.sizes.push_back(transfer.size);
+}
+
+struct Result_t {
+    uint32_t calls = 0;
+    uint32_t failures = 0;
+    bool dataOk = true;
+};
+
+Result_t results[DEVICES];
+
+SPI_Agent<BUS>::Callback_t Check(size_t device, uint8_t first) {
+    return [device, first](uint8_t *data, uint16_t size, bool ok) {
+        results[device].calls++;
+        if (!ok) {
+            results[device].failures++;
+            return;
+        }
+        for (uint16_t i = 0; i < size; ++i) {
+            results[device].dataOk &= data[i] == static_cast<uint8_t>(first + i);
+        }
+    };
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    HostSim::GPIO_SetOutputHook(OnPin);
+    HostSim::SPI_SetDevice(BUS, OnTransfer);
+
+    static SPI_Agent<BUS> flash(GPIOB, CS_PINS[FLASH], Check(FLASH, 0x40));
+    static SPI_Agent<BUS> gyro(GPIOB, CS_PINS[GYRO], Check(GYRO, 0x02));
+    static SPI_Agent<BUS> accel(GPIOB, CS_PINS[ACCEL], Check(ACCEL, 0x12));
+    flash.SetConfig(FLASH_CONFIG);
+    const SPI_Stats_t &stats = SPI_Base<BUS>::GetInstance().GetStats();
+    bool ok = true;
+
+    // 五个请求一次性入队：Flash与陀螺仪交替，加速度计的命令段失败，其后的陀螺仪请求照常完成
+    static uint8_t flashData[2][16], gyroData[2][6], accelData[6];
+    const uint8_t read1[4] = {0x03, 0x00, 0x00, 0x40};
+    const uint8_t read2[4] = {0x03, 0x00, 0x01, 0x40};
+    ok &= flash.WriteRead(read1, sizeof(read1), flashData[0], sizeof(flashData[0]));
+    ok &= gyro.ReadRegister(0x02, gyroData[0], sizeof(gyroData[0]));
+    ok &= flash.WriteRead(read2, sizeof(read2), flashData[1], sizeof(flashData[1]));
+    ok &= accel.ReadRegister(0x12, accelData, sizeof(accelData), 1);
+    ok &= gyro.ReadRegister(0x02, gyroData[1], sizeof(gyroData[1]));
+    HostSim::Run(5);
+
+    // 每次片选依次为：Flash的4字节命令与16字节数据、陀螺仪的地址与6字节数据、加速度计只有失败的命令段
+    const Selection_t expected[] = {{FLASH, {4, 16}}, {GYRO, {1, 6}}, {FLASH, {4, 16}}, {ACCEL, {2}}, {GYRO, {1, 6}}};
+    bool sequenceOk = selections.size() == sizeof(expected) / sizeof(expected[0]);
+    for (size_t i = 0; sequenceOk && i < selections.size(); ++i) {
+        sequenceOk = selections[i].device == expected[i].device && selections[i].sizes == expected[i].sizes;
+    }
+    printf("selections %zu, sequence as expected %d, violations %u, all released %d\n", selections.size(),
+           sequenceOk, violations, !selected);
+    ok &= sequenceOk && violations == 0 && !selected;
+
+    // Flash与默认配置的从机交替，共切换4次；相邻的两个默认配置的请求之间不改写
+    printf("transactions %u, errors %u, reconfigurations %u\n", stats.transactions, stats.errors,
+           stats.reconfigurations);
+    ok &= stats.transactions == 4 && stats.errors == 1 && stats.reconfigurations == 4;
+
+    printf("callbacks: flash %u (data ok %d), gyro %u (data ok %d), accel %u with %u failures\n",
+           results[FLASH].calls, results[FLASH].dataOk, results[GYRO].calls, results[GYRO].dataOk,
+           results[ACCEL].calls, results[ACCEL].failures);
+    ok &= results[FLASH].calls == 2 && results[FLASH].failures == 0 && results[FLASH].dataOk;
+    ok &= results[GYRO].calls == 2 && results[GYRO].failures == 0 && results[GYRO].dataOk;
+    ok &= results[ACCEL].calls == 1 && results[ACCEL].failures == 1;
+    ok &= !flash.IsBusy() && !gyro.IsBusy() && !accel.IsBusy() && SPI_Base<BUS>::GetInstance().GetQueueSize() == 0;
+
+    // 从机恢复后同一代理的请求正常完成
+    failAccel = false;
+    ok &= accel.ReadRegister(0x12, accelData, sizeof(accelData), 1);
+    HostSim::Run(2);
+    printf("accel after recovery: callbacks %u, data ok %d, last selection sizes %zu\n", results[ACCEL].calls,
+           results[ACCEL].dataOk, selections.back().sizes.size());
+    ok &= results[ACCEL].calls == 2 && results[ACCEL].failures == 1 && results[ACCEL].dataOk &&
+          selections.back().device == ACCEL && selections.back().sizes == std::vector<uint16_t>{2, 6};
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#include "Matrix/matrix.h"
+#include "Matrix/SmallMatrix.hpp"
+
+/**
+ * SMatrixf的主机基准与精度校验
+ * @note 先以随机的1~6阶矩阵校验inv与inv_spd的残差 |A * inv(A) - I|；
+ *       再以POV_Chassis中ForwardKinematics的一步融合计算对比Matrixf与SMatrixf的耗时，并校验两者的估计结果一致
+ */
+
+namespace {
+
+constexpr size_t WHEELS = 4;
+constexpr uint32_t SAMPLES = 1000;
+constexpr uint32_t REPEAT = 200000;
+constexpr float INV_TOLERANCE = 1e-3f;
+constexpr float ESTIMATE_TOLERANCE = 1e-4f;
+
+// 运算均可在编译期求值
+constexpr SMatrixf<2, 2> TWICE = smatrixf::eye<2, 2>() * 2.f;
+static_assert(TWICE(1, 1) == 2.f && (TWICE * TWICE)(0, 0) == 4.f && TWICE.trans().trace() == 4.f,
+              "SMatrixf operations should be constexpr");
+
+std::mt19937 generator(3);
+std::uniform_real_distribution<float> uniform(-1, 1);
+
+/**
+ * 校验N阶随机矩阵求逆的最大残差，病态矩阵（逆的迹过大）不计入inv的统计
+ */
+template<size_t N>
+bool CheckInverse() {
+    float worst = 0, worstSpd = 0;
+    for (uint32_t k = 0; k < SAMPLES; ++k) {
+        SMatrixf<N, N> a;
+        for (size_t i = 0; i < N * N; ++i) {
+            a.data()[i] = uniform(generator);
+        }
+        SMatrixf<N, N> inverse = smatrixf::inv(a);
+        if (std::fabs(inverse.trace()) < 100) {
+            worst = std::fmax(worst, (a * inverse - smatrixf::eye<N, N>()).norm());
+        }
+        SMatrixf<N, N> spd = a * a.trans() + 0.1f * smatrixf::eye<N, N>();
+        worstSpd = std::fmax(worstSpd, (spd * smatrixf::inv_spd(spd) - smatrixf::eye<N, N>()).norm());
+    }
+    printf("N=%zu: inv residual %.2e, inv_spd residual %.2e\n", N, worst, worstSpd);
+    return worst < INV_TOLERANCE && worstSpd < INV_TOLERANCE;
+}
+
+template<size_t R, size_t C>
+using OldMatrix = Matrixf<static_cast<int>(R), static_cast<int>(C)>;
+
+/**
+ * ForwardKinematics中的一步融合计算，对两种矩阵类型通用
+ */
+template<template<size_t, size_t> class M, typename Inv>
+float FusionStep(std::array<M<3, 3>, WHEELS> &Jn, std::array<M<3, 1>, WHEELS> &Xn,
+                 std::array<M<2, 3>, WHEELS> &Hn, const M<2, 2> &B, const M<3, 3> &Q,
+                 float *targetV, const float *vels, Inv inv) {
+    constexpr float alpha = 0.5f;
+    std::array<M<3, 3>, WHEELS> Wn;
+    std::array<M<3, 1>, WHEELS> wn;
+    for (size_t i = 0; i < WHEELS; ++i) {
+        M<2, 1> vel;
+        vel[0][0] = vels[2 * i];
+        vel[1][0] = vels[2 * i + 1];
+        Xn[i] = alpha * Xn[i] + (1 - alpha) * M<3, 1>(targetV);
+        Jn[i] = inv(alpha * alpha * inv(Jn[i]) + 0.5f * Q);
+        Wn[i] = Jn[i] / WHEELS + Hn[i].trans() * B * Hn[i];
+        wn[i] = Jn[i] / WHEELS * Xn[i] + Hn[i].trans() * B * vel;
+    }
+    M<3, 3> W = Wn[0] * 0.f;
+    M<3, 1> w = wn[0] * 0.f;
+    for (size_t i = 0; i < WHEELS; ++i) {
+        W += Wn[i] / WHEELS;
+        w += wn[i] / WHEELS;
+    }
+    M<3, 1> X = inv(W) * w;
+    for (size_t i = 0; i < WHEELS; ++i) {
+        Xn[i] = X;
+        Jn[i] = WHEELS * W;
+    }
+    return X[0][0];
+}
+
+/**
+ * 以固定的轮速序列重复执行融合计算，返回每步耗时，estimate为最后一步的估计结果
+ */
+template<template<size_t, size_t> class M, typename Inv>
+double MeasureFusion(Inv inv, float &estimate) {
+    std::array<M<3, 3>, WHEELS> Jn;
+    std::array<M<3, 1>, WHEELS> Xn;
+    std::array<M<2, 3>, WHEELS> Hn;
+    const float lx[WHEELS] = {0.12f, 0.12f, -0.12f, -0.12f};
+    const float ly[WHEELS] = {-0.12f, 0.12f, 0.12f, -0.12f};
+    for (size_t i = 0; i < WHEELS; ++i) {
+        float h[6] = {1, 0, -ly[i], 0, 1, lx[i]};
+        Hn[i] = M<2, 3>(h);
+        Jn[i] = Jn[i] * 0.f;
+        Xn[i] = Xn[i] * 0.f;
+        for (size_t k = 0; k < 3; ++k) {
+            Jn[i][k][k] = 1;
+        }
+    }
+    float b[4] = {100, 0, 0, 100};
+    float q[9] = {0.1f, 0, 0, 0, 0.1f, 0, 0, 0, 0.1f};
+    M<2, 2> B(b);
+    M<3, 3> Q(q);
+    float targetV[3] = {1, 0.5f, 0.2f};
+    float vels[2 * WHEELS];
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t k = 0; k < REPEAT; ++k) {
+        for (size_t i = 0; i < 2 * WHEELS; ++i) {
+            vels[i] = 0.5f + 0.001f * static_cast<float>((k + i) & 63u);
+        }
+        estimate = FusionStep<M>(Jn, Xn, Hn, B, Q, targetV, vels, inv);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / REPEAT;
+}
+
+}
+
+int main() {
+    bool ok = CheckInverse<1>() & CheckInverse<2>() & CheckInverse<3>() & CheckInverse<4>() & CheckInverse<5>() &
+              CheckInverse<6>();
+
+    float oldEstimate = 0, newEstimate = 0;
+    double oldNs = MeasureFusion<OldMatrix>([](const auto &m) { return matrixf::inv(m); }, oldEstimate);
+    double newNs = MeasureFusion<SMatrixf>([](const auto &m) { return smatrixf::inv(m); }, newEstimate);
+    printf("ForwardKinematics step (%zu wheels): Matrixf %.0f ns, SMatrixf %.0f ns, estimate %.6f vs %.6f\n", WHEELS,
+           oldNs, newNs, oldEstimate, newEstimate);
+    ok &= std::fabs(oldEstimate - newEstimate) < ESTIMATE_TOLERANCE;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Bus/UART_Base.hpp"
+#include "Verification/CRC.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * 分段发送与分段校验的测试
+ * @note 同一数据随机切分为若干段（含空段）时，分段校验与拼接后的校验一致；帧头、负载与校验分别存放的帧经TransmitV发送，
+ *       跨越发送缓冲区边界时仍完整到达，各段在返回后立即被改写；空闲缓冲区不足时整帧被拒绝，线上不出现残帧
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 2;
+constexpr size_t HEADER = 3, PAYLOAD = 70;
+
+std::vector<uint8_t> line;
+std::mt19937 generator(5);
+
+/**
+ * 将data随机切分为至多8段，允许出现空段
+ */
+std::vector<IOVec_t> Split(const uint8_t *data, size_t size) {
+    std::vector<IOVec_t> segments;
+    size_t offset = 0;
+    while (offset < size && segments.size() < 7) {
+        size_t n = std::uniform_int_distribution<size_t>(0, size - offset)(generator);
+        segments.push_back({data + offset, static_cast<uint16_t>(n)});
+        offset += n;
+    }
+    segments.push_back({data + offset, static_cast<uint16_t>(size - offset)});
+    return segments;
+}
+
+bool CheckCRC() {
+    uint8_t data[200];
+    bool ok = true;
+    for (uint32_t k = 0; k < 1000; ++k) {
+        size_t size = std::uniform_int_distribution<size_t>(1, sizeof(data))(generator);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<uint8_t>(generator());
+        }
+        std::vector<IOVec_t> segments = Split(data, size);
+        ok &= CRC8Calc(segments.data(), segments.size()) == CRC8Calc(data, size);
+        ok &= CRC16Calc(segments.data(), segments.size()) == CRC16Calc(data, size);
+        ok &= CRC32Calc(segments.data(), segments.size()) == CRC32Calc(data, size);
+    }
+    printf("segment-wise CRC8/16/32 over 1000 random splits: match %d\n", ok);
+    return ok;
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    HostSim::UART_SetTxHook(BUS, [](const uint8_t *data, size_t size) {
+        line.insert(line.end(), data, data + size);
+    });
+    UART_Base<BUS> &uart = UART_Base<BUS>::GetInstance();
+    bool ok = CheckCRC();
+
+    // 帧头+负载+CRC16共75字节，跨越两个发送缓冲区；校验对帧头与负载两段计算
+    std::vector<uint8_t> expected;
+    uint8_t header[HEADER], payload[PAYLOAD], crc[2];
+    for (uint32_t k = 0; k < 20; ++k) {
+        header[0] = 0xA5;
+        header[1] = static_cast<uint8_t>(k);
+        header[2] = PAYLOAD;
+        for (size_t i = 0; i < PAYLOAD; ++i) {
+            payload[i] = static_cast<uint8_t>(k * 13 + i);
+        }
+        IOVec_t segments[3] = {{header, HEADER}, {payload, PAYLOAD}, {crc, 2}};
+        uint16_t value = CRC16Calc(segments, 2);
+        crc[0] = static_cast<uint8_t>(value);
+        crc[1] = static_cast<uint8_t>(value >> 8u);
+        if (!uart.TransmitV(segments, 3)) {
+            ok = false;
+        }
+        expected.insert(expected.end(), header, header + HEADER);
+        expected.insert(expected.end(), payload, payload + PAYLOAD);
+        expected.insert(expected.end(), crc, crc + 2);
+        memset(header, 0xEE, sizeof(header));
+        memset(payload, 0xEE, sizeof(payload));
+        memset(crc, 0xEE, sizeof(crc));
+        HostSim::Run(20);
+    }
+
+    // 接收端按拼接后的帧重新校验
+    bool framesOk = line == expected;
+    for (size_t offset = 0; framesOk && offset < line.size(); offset += HEADER + PAYLOAD + 2) {
+        uint16_t value = CRC16Calc(line.data() + offset, HEADER + PAYLOAD);
+        framesOk = line[offset + HEADER + PAYLOAD] == static_cast<uint8_t>(value) &&
+                   line[offset + HEADER + PAYLOAD + 1] == static_cast<uint8_t>(value >> 8u);
+    }
+    printf("20 frames of %zu+%zu+2 bytes: %zu bytes on the line, intact with valid CRC %d\n", HEADER, PAYLOAD,
+           line.size(), framesOk);
+    ok &= framesOk;
+
+    // 只剩一个空闲缓冲区时，需要两个缓冲区的帧被整帧拒绝
+    uint8_t *held[UART_TX_SLOT_COUNT - 1];
+    for (uint8_t *&slot: held) {
+        slot = uart.AcquireTxBuffer();
+    }
+    IOVec_t segments[3] = {{header, HEADER}, {payload, PAYLOAD}, {crc, 2}};
+    size_t before = line.size();
+    bool rejected = !uart.TransmitV(segments, 3);
+    bool fits = uart.TransmitV(segments, 1);
+    HostSim::Run(20);
+    for (uint8_t *slot: held) {
+        uart.Release(slot);
+    }
+    printf("one free slot: 75-byte frame rejected %d, 3-byte frame sent %d, bytes on the line %zu\n", rejected, fits,
+           line.size() - before);
+    ok &= rejected && fits && line.size() - before == HEADER;
+    return ok ? 0 : 1;
+}
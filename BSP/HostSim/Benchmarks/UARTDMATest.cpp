@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Bus/UART_Base.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * 循环DMA接收的测试：UART2使用循环DMA，以25字节的UARTBuffer接收，组帧结果应与中断模式的语义一致，
+ * 即每次空闲提交一帧、累计满25字节时提交一帧
+ * @note 覆盖空闲恰好落在环形缓冲区末尾（HAL不产生空闲事件）、帧跨越缓冲区回绕与半满位置、无空闲的连续数据等情况
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 2;
+constexpr size_t FRAME = 25;
+
+std::vector<std::vector<uint8_t>> received;
+std::vector<std::vector<uint8_t>> expected;
+uint8_t next = 0;
+
+/**
+ * 发送size字节后总线空闲，按中断模式的语义记录应提交的帧
+ */
+void Send(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (uint8_t &byte: data) {
+        byte = next++;
+    }
+    for (size_t i = 0; i < size; i += FRAME) {
+        expected.emplace_back(data.begin() + i, data.begin() + (size - i < FRAME ? size : i + FRAME));
+    }
+    HostSim::UART_Inject(BUS, data.data(), size);
+}
+
+bool Matches() {
+    return received == expected;
+}
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    static UARTBuffer<BUS, FRAME> buffer([](uint8_t *data, size_t size) {
+        received.emplace_back(data, data + size);
+    });
+    const UART_Stats_t &stats = UART_Base<BUS>::GetInstance().GetStats();
+    bool ok = BSP_UART<BUS>::GetInstance().IsRxCircular();
+
+    // 4 * 25 + 8 + 20 = 128，不足一帧的第6帧恰好结束于环形缓冲区末尾，须在空闲时立即提交而不与下一帧合并
+    for (size_t i = 0; i < 4; ++i) {
+        Send(FRAME);
+    }
+    Send(8);
+    Send(20);
+    bool wrapOk = Matches() && received.size() == 6;
+    Send(7);
+    wrapOk &= Matches();
+    printf("idle at the end of the ring: frames %zu, match %d\n", received.size(), wrapOk);
+    ok &= wrapOk;
+
+    // 随机长度的帧，依次跨过半满位置与回绕位置
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<size_t> length(1, FRAME);
+    for (size_t i = 0; i < 200; ++i) {
+        Send(length(generator));
+        HostSim::Tick();
+    }
+    bool randomOk = Matches();
+    printf("200 random-length frames: match %d\n", randomOk);
+    ok &= randomOk;
+
+    // 无空闲的连续数据按缓冲区长度切分，最后不足一帧的部分在空闲时提交
+    Send(2 * FRAME);
+    Send(2 * FRAME + 10);
+    Send(3 * FRAME + FRAME / 2);
+    bool burstOk = Matches();
+    printf("bursts without idle: match %d\n", burstOk);
+    ok &= burstOk;
+
+    // 中断模式每字节一次中断，循环DMA只在半满、全满与空闲时中断
+    printf("bytes %u, frames %u (expected %zu), interrupts %u, errors %u, dropped by the line %u\n", stats.rxBytes,
+           stats.rxFrames, expected.size(), stats.irqCount, stats.errors, HostSim::UART_GetStats(BUS).rxDropped);
+    ok &= stats.rxFrames == expected.size() && stats.errors == 0 && HostSim::UART_GetStats(BUS).rxDropped == 0;
+    ok &= stats.irqCount < stats.rxBytes / 4;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "Bus/UART_Base.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * 串口发送缓冲区池的测试：以超过115200波特率的速率持续发送，每次Transmit返回后立即改写源数据
+ * @note 线上的字节流应与被接受的消息逐字节一致，缓冲区不足时整条消息被拒绝并计入txOverflow，已排队的消息不受影响
+ */
+
+namespace {
+
+constexpr uint8_t BUS = 2;
+constexpr size_t MESSAGE = 40;
+constexpr uint32_t TICKS = 300;
+
+std::vector<uint8_t> line;
+
+}
+
+int main() {
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    HostSim::UART_SetTxHook(BUS, [](const uint8_t *data, size_t size) {
+        line.insert(line.end(), data, data + size);
+    });
+    UART_Base<BUS> &uart = UART_Base<BUS>::GetInstance();
+    const UART_Stats_t &stats = uart.GetStats();
+    bool ok = true;
+
+    // 申请全部缓冲区后再申请失败；归还一个后可再次申请；不属于本串口的缓冲区不能提交
+    uint8_t *slots[UART_TX_SLOT_COUNT];
+    for (uint8_t *&slot: slots) {
+        slot = uart.AcquireTxBuffer();
+        ok &= slot != nullptr;
+    }
+    bool exhausted = uart.AcquireTxBuffer() == nullptr && !uart.Transmit(slots[0], 1);
+    uart.Release(slots[0]);
+    bool reacquired = uart.AcquireTxBuffer() == slots[0];
+    uint8_t foreign[4] = {};
+    bool foreignRejected = !uart.Commit(foreign, sizeof(foreign));
+    for (uint8_t *slot: slots) {
+        uart.Release(slot);
+    }
+    printf("pool: exhausted %d, reacquired %d, foreign buffer rejected %d, overflow %u\n", exhausted, reacquired,
+           foreignRejected, stats.txOverflow);
+    ok &= exhausted && reacquired && foreignRejected && stats.txOverflow == 2;
+
+    // 每个周期发送两条消息，约为线速的7倍；源数据在返回后立即被改写
+    std::vector<uint8_t> accepted;
+    uint32_t rejected = 0, offered = 0;
+    uint32_t overflowBefore = stats.txOverflow;
+    uint8_t source[3 * UART_TX_SLOT_SIZE];
+    for (uint32_t k = 0; k < TICKS; ++k) {
+        for (uint32_t m = 0; m < 2; ++m) {
+            // 每10条中有一条跨越3个缓冲区
+            size_t size = offered % 10 == 0 ? sizeof(source) - 7 : MESSAGE;
+            for (size_t i = 0; i < size; ++i) {
+                source[i] = static_cast<uint8_t>(offered * 7 + i);
+            }
+            if (uart.Transmit(source, size)) {
+                accepted.insert(accepted.end(), source, source + size);
+            } else {
+                rejected++;
+            }
+            offered++;
+            memset(source, 0xEE, sizeof(source));
+        }
+        HostSim::Tick();
+    }
+    HostSim::Run(2000);
+
+    printf("offered %u messages, rejected %u (txOverflow %u); %zu bytes accepted, %zu on the line, intact %d\n",
+           offered, rejected, stats.txOverflow - overflowBefore, accepted.size(), line.size(), line == accepted);
+    ok &= rejected > 0 && stats.txOverflow - overflowBefore == rejected && line == accepted;
+    ok &= stats.txBytes == line.size();
+
+    // 排空后所有缓冲区均已归还
+    size_t freeSlots = 0;
+    for (uint8_t *&slot: slots) {
+        slot = uart.AcquireTxBuffer();
+        freeSlots += slot != nullptr;
+    }
+    for (uint8_t *slot: slots) {
+        uart.Release(slot);
+    }
+    printf("free slots after draining: %zu of %d\n", freeSlots, UART_TX_SLOT_COUNT);
+    ok &= freeSlots == UART_TX_SLOT_COUNT;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,12 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_BOARD_H
+#define FINEMOTE_BOARD_H
+
+#include "HostSim.h"
+
+#endif
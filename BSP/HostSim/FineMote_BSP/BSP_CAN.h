@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Copyright (c) 2024.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef BSP_CAN_H
+#define BSP_CAN_H
+
+#include "Board.h"
+
+class BSP_CANs {
+public:
+    static BSP_CANs &GetInstance() {
+        static BSP_CANs instance;
+        return instance;
+    }
+
+private:
+    BSP_CANs() {
+        PeripheralsInit::GetInstance();
+        BSP_CANs_Setup();
+    }
+
+    void BSP_CANs_Setup() {
+    }
+};
+
+#define BSP_CAN_FILTER_BANKS_PER_BUS 14
+
+template<uint8_t ID>
+class BSP_CAN {
+public:
+    static BSP_CAN &GetInstance() {
+        static BSP_CAN instance;
+        return instance;
+    }
+
+    /**
+     * @return 没有空闲发送邮箱时返回false
+     */
+    bool Transmit(CAN_TxHeaderTypeDef *Header, const uint8_t *data);
+
+    uint32_t GetTxMailboxesFreeLevel() {
+        return HAL_CAN_GetTxMailboxesFreeLevel(BSP_CANList[ID]);
+    }
+
+    /**
+     * @param FIFO CAN_RX_FIFO0 or CAN_RX_FIFO1
+     * @return FIFO为空或读取失败时返回false
+     */
+    bool Receive(uint32_t FIFO, CAN_RxHeaderTypeDef *Header, uint8_t *data);
+
+    uint32_t GetRxFifoFillLevel(uint32_t FIFO) {
+        return HAL_CAN_GetRxFifoFillLevel(BSP_CANList[ID], FIFO);
+    }
+
+    /**
+     * 读取并清除HAL记录的错误标志，如HAL_CAN_ERROR_RX_FOV0
+     */
+    uint32_t FetchError() {
+        uint32_t error = HAL_CAN_GetError(BSP_CANList[ID]);
+        HAL_CAN_ResetError(BSP_CANList[ID]);
+        return error;
+    }
+
+    /**
+     * 为指定标识符添加硬件过滤器，未添加过滤器的帧不会进入接收FIFO
+     * @param addr 标识符
+     * @param IDE CAN_ID_STD or CAN_ID_EXT
+     * @param FIFO 匹配的帧进入的接收FIFO，CAN_RX_FIFO0 or CAN_RX_FIFO1
+     * @return 过滤器组用尽时退化为接收全部帧并返回false
+     * @note 标准帧使用16位列表模式，每组4个标识符；扩展帧使用32位列表模式，每组2个标识符，两个FIFO分别占用不同的过滤器组
+     */
+    bool AddFilter(uint32_t addr, uint32_t IDE, uint32_t FIFO = CAN_RX_FIFO0);
+
+private:
+    BSP_CAN() {
+        static_assert(ID > 0 && ID <= CAN_BUS_MAXIMUM_COUNT && BSP_CANList[ID] != nullptr, "Invalid CAN ID");
+        BSP_CANs::GetInstance();
+        BSP_CAN_Setup();
+    }
+
+    void PeriphralInit() {
+        HAL_CAN_ActivateNotification(BSP_CANList[ID], CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_RX_FIFO0_OVERRUN);
+        HAL_CAN_ActivateNotification(BSP_CANList[ID], CAN_IT_RX_FIFO1_MSG_PENDING | CAN_IT_RX_FIFO1_OVERRUN);
+        HAL_CAN_ActivateNotification(BSP_CANList[ID], CAN_IT_TX_MAILBOX_EMPTY);
+
+        // 发送邮箱按请求顺序发送(TXFP)，与CAN_Base发送队列的出队顺序一致，标识符相同的帧不会因邮箱编号而乱序；
+        // 启动前外设仍处于初始化模式，可修改MCR
+        BSP_CANList[ID]->Instance->MCR |= CAN_MCR_TXFP;
+        HAL_CAN_Start(BSP_CANList[ID]);
+    }
+
+    void BSP_CAN_Setup() {
+        PeriphralInit();
+    }
+
+    void ConfigFilter(uint32_t bank, uint32_t mode, uint32_t scale, uint32_t FR1, uint32_t FR2,
+                      uint32_t FIFO = CAN_RX_FIFO0) {
+        CAN_FilterTypeDef canFilter;
+        canFilter.FilterMode = mode;
+        canFilter.FilterScale = scale;
+        if (scale == CAN_FILTERSCALE_32BIT) {
+            canFilter.FilterIdHigh = FR1 >> 16;
+            canFilter.FilterIdLow = FR1 & 0xFFFF;
+            canFilter.FilterMaskIdHigh = FR2 >> 16;
+            canFilter.FilterMaskIdLow = FR2 & 0xFFFF;
+        } else {
+            canFilter.FilterIdHigh = FR2 & 0xFFFF;
+            canFilter.FilterIdLow = FR1 & 0xFFFF;
+            canFilter.FilterMaskIdHigh = FR2 >> 16;
+            canFilter.FilterMaskIdLow = FR1 >> 16;
+        }
+        canFilter.FilterFIFOAssignment = FIFO == CAN_RX_FIFO1 ? CAN_FILTER_FIFO1 : CAN_FILTER_FIFO0;
+        canFilter.FilterActivation = ENABLE;
+        canFilter.FilterBank = firstBank + bank;
+        canFilter.SlaveStartFilterBank = BSP_CAN_FILTER_BANKS_PER_BUS;
+        HAL_CAN_ConfigFilter(BSP_CANList[ID], &canFilter);
+    }
+
+    static constexpr uint32_t firstBank = (ID - 1) * BSP_CAN_FILTER_BANKS_PER_BUS;
+
+    uint32_t usedBanks = 0;
+    bool acceptAll = false;
+
+    // 每个FIFO当前未填满的列表组，未使用的位置重复填入第一个标识符
+    int32_t stdBank[2] = {-1, -1};
+    uint16_t stdList[2][4] = {};
+    uint8_t stdCount[2] = {};
+    int32_t extBank[2] = {-1, -1};
+    uint32_t extList[2][2] = {};
+    uint8_t extCount[2] = {};
+};
+
+template<uint8_t ID>
+bool BSP_CAN<ID>::AddFilter(uint32_t addr, uint32_t IDE, uint32_t FIFO) {
+    if (acceptAll) {
+        return false;
+    }
+
+    uint8_t f = FIFO == CAN_RX_FIFO1 ? 1 : 0;
+    if (IDE == CAN_ID_EXT) {
+        if (extBank[f] < 0 || extCount[f] == 2) {
+            if (usedBanks == BSP_CAN_FILTER_BANKS_PER_BUS) {
+                acceptAll = true;
+            } else {
+                extBank[f] = usedBanks++;
+                extCount[f] = 0;
+            }
+        }
+        if (!acceptAll) {
+            uint32_t *list = extList[f];
+            list[extCount[f]++] = (addr << 3) | CAN_ID_EXT;
+            ConfigFilter(extBank[f], CAN_FILTERMODE_IDLIST, CAN_FILTERSCALE_32BIT,
+                         list[0], list[extCount[f] > 1 ? 1 : 0], FIFO);
+            return true;
+        }
+    } else {
+        if (stdBank[f] < 0 || stdCount[f] == 4) {
+            if (usedBanks == BSP_CAN_FILTER_BANKS_PER_BUS) {
+                acceptAll = true;
+            } else {
+                stdBank[f] = usedBanks++;
+                stdCount[f] = 0;
+            }
+        }
+        if (!acceptAll) {
+            stdList[f][stdCount[f]++] = static_cast<uint16_t>(addr << 5);
+            uint32_t list[4];
+            for (uint8_t i = 0; i < 4; ++i) {
+                list[i] = stdList[f][i < stdCount[f] ? i : 0];
+            }
+            ConfigFilter(stdBank[f], CAN_FILTERMODE_IDLIST, CAN_FILTERSCALE_16BIT,
+                         list[1] << 16 | list[0], list[3] << 16 | list[2], FIFO);
+            return true;
+        }
+    }
+
+    // 过滤器组用尽，最后一组改为全接收的掩码过滤器，由软件分发丢弃无关帧
+    // bxCAN按32位组、16位组的顺序匹配，同位宽时列表模式优先于掩码模式，因此全接收组使用16位掩码模式，
+    // 其余组中分配到FIFO1的标识符仍进入FIFO1；原先位于最后一组的标识符改由全接收组接收，进入FIFO0
+    ConfigFilter(BSP_CAN_FILTER_BANKS_PER_BUS - 1, CAN_FILTERMODE_IDMASK, CAN_FILTERSCALE_16BIT, 0, 0);
+    return false;
+}
+
+template<uint8_t ID>
+bool BSP_CAN<ID>::Receive(uint32_t FIFO, CAN_RxHeaderTypeDef *Header, uint8_t *data) {
+    return HAL_CAN_GetRxMessage(BSP_CANList[ID], FIFO, Header, data) == HAL_OK;
+}
+
+template<uint8_t ID>
+bool BSP_CAN<ID>::Transmit(CAN_TxHeaderTypeDef *Header, const uint8_t *data) {
+    uint32_t TxMailbox = 0;
+    return HAL_CAN_AddTxMessage(BSP_CANList[ID], Header, data, &TxMailbox) == HAL_OK;
+}
+
+#endif
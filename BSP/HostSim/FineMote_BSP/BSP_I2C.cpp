@@ -0,0 +1,36 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include "BSP_I2C.h"
+#include "Bus/I2C_Base.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    FineMoteAux_I2C<>::OnComplete(hi2c, true);
+}
+
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    FineMoteAux_I2C<>::OnComplete(hi2c, true);
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    FineMoteAux_I2C<>::OnComplete(hi2c, true);
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    FineMoteAux_I2C<>::OnComplete(hi2c, true);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+    FineMoteAux_I2C<>::OnComplete(hi2c, false);
+}
+
+#ifdef __cplusplus
+}
+#endif
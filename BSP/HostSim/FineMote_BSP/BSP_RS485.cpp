@@ -0,0 +1,7 @@
+/*******************************************************************************
+* Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include "BSP_RS485.h"
@@ -0,0 +1,32 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include "BSP_SPI.h"
+#include "Bus/SPI_Base.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi) {
+    FineMoteAux_SPI<>::OnComplete(hspi, true);
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+    FineMoteAux_SPI<>::OnComplete(hspi, true);
+}
+
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi) {
+    FineMoteAux_SPI<>::OnComplete(hspi, true);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+    FineMoteAux_SPI<>::OnComplete(hspi, false);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_BSP_UART_H
+#define FINEMOTE_BSP_UART_H
+
+#include "Board.h"
+
+class BSP_UARTs {
+public:
+    static BSP_UARTs& GetInstance() {
+        static BSP_UARTs instance;
+        return instance;
+    }
+
+private:
+    BSP_UARTs() {
+        PeripheralsInit::GetInstance();
+        BSP_UARTs_Setup();
+    }
+    void BSP_UARTs_Setup();
+};
+
+template <uint8_t ID>
+class BSP_UART {
+public:
+    static BSP_UART& GetInstance() {
+        static BSP_UART instance;
+        return instance;
+    }
+
+    void Transmit(uint8_t* data, uint16_t size);
+
+    /**
+     * 中断模式下接收到空闲或填满size字节后停止；循环DMA模式下只需启动一次，之后在空闲、半满与全满时触发接收事件
+     * @note 循环DMA模式下接收事件的size为DMA在缓冲区中的写入位置
+     */
+    void Receive(uint8_t* data, uint16_t size);
+
+    bool IsTxDMA() const {
+        return txDMA;
+    }
+
+    bool IsRxCircular() const {
+        return rxCircular;
+    }
+
+    HAL_UART_RxEventTypeTypeDef GetRxEventType() {
+        return HAL_UARTEx_GetRxEventType(BSP_UARTList[ID]);
+    }
+
+    /**
+     * 循环DMA恰好写满缓冲区后总线空闲时，DMA计数器已重装为满值，HAL不会产生空闲事件
+     * 需在串口中断入口、HAL清除空闲标志之前调用
+     */
+    bool IsIdleAtWrap() {
+        UART_HandleTypeDef *huart = BSP_UARTList[ID];
+        return rxCircular && __HAL_UART_GET_FLAG(huart, UART_FLAG_IDLE) &&
+               __HAL_DMA_GET_COUNTER(huart->hdmarx) == huart->RxXferSize;
+    }
+
+private:
+    BSP_UART() {
+        static_assert(ID > 0 && ID < sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) && BSP_UARTList[ID] != nullptr, "Invalid UART ID");
+        BSP_UARTs::GetInstance();
+        BSP_UART_Setup();
+    }
+    void BSP_UART_Setup();
+
+    bool txDMA = false;
+    bool rxCircular = false;
+};
+
+/**
+ * BSP Specific Definitions
+ */
+
+inline void BSP_UARTs::BSP_UARTs_Setup() {
+
+}
+
+template<uint8_t ID>
+void BSP_UART<ID>::BSP_UART_Setup() {
+    if constexpr (BSP_UARTDMAList[ID]) {
+        UART_HandleTypeDef *huart = BSP_UARTList[ID];
+        txDMA = huart->hdmatx != nullptr;
+        if (huart->hdmarx != nullptr) {
+            // CubeMX生成的接收DMA为普通模式，此处改为循环模式
+            huart->hdmarx->Init.Mode = DMA_CIRCULAR;
+            rxCircular = HAL_DMA_Init(huart->hdmarx) == HAL_OK;
+        }
+    }
+}
+
+template<uint8_t ID>
+void BSP_UART<ID>::Transmit(uint8_t *data, uint16_t size) {
+    if (txDMA) {
+        HAL_UART_Transmit_DMA(BSP_UARTList[ID], data, size);
+    } else {
+        HAL_UART_Transmit_IT(BSP_UARTList[ID], data, size);
+    }
+}
+
+template<uint8_t ID>
+void BSP_UART<ID>::Receive(uint8_t *data, uint16_t size) {
+    if (rxCircular) {
+        HAL_UARTEx_ReceiveToIdle_DMA(BSP_UARTList[ID], data, size);
+    } else {
+        HAL_UARTEx_ReceiveToIdle_IT(BSP_UARTList[ID], data, size);
+    }
+}
+
+#endif
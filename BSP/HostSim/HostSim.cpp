@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include "HostSim.h"
+
+DMA_Stream_TypeDef HostSim_DMA1_Stream3 = {};
+DMA_Stream_TypeDef HostSim_DMA1_Stream4 = {};
+DMA_Stream_TypeDef HostSim_DMA1_Stream5 = {};
+DMA_Stream_TypeDef HostSim_DMA1_Stream6 = {};
+DMA_HandleTypeDef hdma_usart2_rx = {&HostSim_DMA1_Stream5, {DMA_NORMAL}};
+DMA_HandleTypeDef hdma_usart2_tx = {&HostSim_DMA1_Stream6, {DMA_NORMAL}};
+DMA_HandleTypeDef hdma_spi2_rx = {&HostSim_DMA1_Stream3, {DMA_NORMAL}};
+DMA_HandleTypeDef hdma_spi2_tx = {&HostSim_DMA1_Stream4, {DMA_NORMAL}};
+
+UART_HandleTypeDef huart1 = {USART1, {115200}};
+UART_HandleTypeDef huart2 = {USART2, {115200}, 0, 0, &hdma_usart2_tx, &hdma_usart2_rx};
+UART_HandleTypeDef huart3 = {USART3, {100000}};
+UART_HandleTypeDef huart5 = {UART5, {115200}};
+CAN_HandleTypeDef hcan1 = {CAN1};
+CAN_HandleTypeDef hcan2 = {CAN2};
+I2C_HandleTypeDef hi2c1 = {I2C1, {100000}};
+I2C_HandleTypeDef hi2c3 = {I2C3, {100000}};
+SPI_HandleTypeDef hspi2 = {SPI2, {SPI_POLARITY_HIGH, SPI_PHASE_2EDGE, SPI_BAUDRATEPRESCALER_128}, &hdma_spi2_tx, &hdma_spi2_rx};
+TIM_HandleTypeDef htim2 = {TIM2};
+TIM_HandleTypeDef htim7 = {TIM7};
+TIM_HandleTypeDef htim8 = {TIM8};
+IWDG_HandleTypeDef hiwdg = {};
+
+/**
+ * 对应目标板上由CubeMX生成的外设初始化，此处只需设置PWM定时器的预分频与重装载值，以及初始化I2C外设
+ */
+void HostSim_Init() {
+    TIM8->PSC = 167;
+    TIM8->ARR = 19999;
+    TIM2->PSC = 83;
+    TIM2->ARR = 999;
+    SPI2->CR1 = SPI_POLARITY_HIGH | SPI_PHASE_2EDGE | SPI_BAUDRATEPRESCALER_128;
+    HAL_I2C_Init(&hi2c1);
+    HAL_I2C_Init(&hi2c3);
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup() {
+    HAL_TIM_Base_Start_IT(&TIM_Control);
+}
+
+#ifdef __cplusplus
+}
+#endif
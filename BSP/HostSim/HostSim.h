@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_HOSTSIM_H
+#define FINEMOTE_HOSTSIM_H
+
+#include "HostSim_HAL.h"
+
+void HostSim_Init();
+
+class PeripheralsInit {
+
+    PeripheralsInit() {
+        HostSim_Init();
+    }
+
+public:
+    PeripheralsInit(const PeripheralsInit &) = delete;
+
+    PeripheralsInit &operator=(const PeripheralsInit &) = delete;
+
+    static PeripheralsInit &GetInstance() {
+        static PeripheralsInit instance;
+        return instance;
+    }
+};
+
+extern UART_HandleTypeDef huart1;
+extern UART_HandleTypeDef huart2;
+extern UART_HandleTypeDef huart3;
+extern UART_HandleTypeDef huart5;
+extern CAN_HandleTypeDef hcan1;
+extern CAN_HandleTypeDef hcan2;
+extern I2C_HandleTypeDef hi2c1;
+extern I2C_HandleTypeDef hi2c3;
+extern SPI_HandleTypeDef hspi2;
+extern TIM_HandleTypeDef htim2;
+extern TIM_HandleTypeDef htim7;
+extern TIM_HandleTypeDef htim8;
+extern IWDG_HandleTypeDef hiwdg;
+
+/**
+ * UART Definitions
+ */
+constexpr UART_HandleTypeDef *BSP_UARTList[] = {nullptr, &huart1, &huart2, &huart3, nullptr, &huart5};
+constexpr size_t UART_BUS_MAXIMUM_COUNT = sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) - 1;
+// 为true时使用DMA收发：发送为普通DMA，接收为循环DMA；未在CubeMX中配置DMA流的方向仍使用中断
+constexpr bool BSP_UARTDMAList[] = {false, false, true, false, false, false};
+static_assert(sizeof(BSP_UARTDMAList) == sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) * sizeof(bool), "BSP_UARTDMAList should match BSP_UARTList");
+
+/**
+ * RS485 Definitions
+ */
+constexpr size_t BSP_RS485UARTIndexList[] = {0, 1, 2};
+constexpr size_t RS485_BUS_MAXIMUM_COUNT = sizeof(BSP_RS485UARTIndexList) / sizeof(BSP_RS485UARTIndexList[0]) - 1;
+
+inline GPIO_TypeDef *const BSP_RS485FlowCtrlPortList[3] = {nullptr, GPIOC, GPIOB};
+constexpr uint16_t BSP_RS485FlowCtrlPinList[3] = {0, GPIO_PIN_15, GPIO_PIN_3};
+
+/**
+ * CAN Definitions
+ */
+constexpr CAN_HandleTypeDef *BSP_CANList[] = {nullptr, &hcan1, &hcan2};
+constexpr size_t CAN_BUS_MAXIMUM_COUNT = sizeof(BSP_CANList) / sizeof(BSP_CANList[0]) - 1;
+
+/**
+ * I2C Definitions
+ */
+// 下标与I2C外设编号一致；在CubeMX中配置了DMA流的方向使用DMA传输，否则使用中断
+constexpr I2C_HandleTypeDef *BSP_I2CList[] = {nullptr, &hi2c1, nullptr, &hi2c3};
+constexpr size_t I2C_BUS_MAXIMUM_COUNT = sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]) - 1;
+// 总线恢复时以GPIO补发时钟的SCL与SDA引脚，与CubeMX中各I2C的复用引脚一致
+inline GPIO_TypeDef *const BSP_I2CSCLPortList[] = {nullptr, GPIOB, nullptr, GPIOA};
+constexpr uint16_t BSP_I2CSCLPinList[] = {0, GPIO_PIN_6, 0, GPIO_PIN_8};
+inline GPIO_TypeDef *const BSP_I2CSDAPortList[] = {nullptr, GPIOB, nullptr, GPIOB};
+constexpr uint16_t BSP_I2CSDAPinList[] = {0, GPIO_PIN_7, 0, GPIO_PIN_4};
+static_assert(sizeof(BSP_I2CSCLPinList) == sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]) * sizeof(uint16_t) &&
+              sizeof(BSP_I2CSDAPinList) == sizeof(BSP_I2CSCLPinList), "BSP_I2C pin lists should match BSP_I2CList");
+
+/**
+ * SPI Definitions
+ */
+// 下标与SPI外设编号一致；收发DMA流均已配置的总线使用DMA传输，否则使用中断
+constexpr SPI_HandleTypeDef *BSP_SPIList[] = {nullptr, nullptr, &hspi2};
+constexpr size_t SPI_BUS_MAXIMUM_COUNT = sizeof(BSP_SPIList) / sizeof(BSP_SPIList[0]) - 1;
+
+/**
+ * PWM Definitions
+ */
+using PWMList_t = struct PWMList_t {
+  uint32_t TIM_CHANNEL;
+  TIM_HandleTypeDef *TIM_Handle = nullptr;
+  uint16_t TIM_Frequency = 168; // Default frequency
+};
+
+constexpr PWMList_t BSP_PWMList[6] = {
+  {0, nullptr, 0},
+  {TIM_CHANNEL_1, &htim8, 168},
+  {TIM_CHANNEL_2, &htim8, 168},
+  {TIM_CHANNEL_3, &htim8, 168},
+  {TIM_CHANNEL_4, &htim8, 168},
+  {TIM_CHANNEL_4, &htim2, 84}  // BUZZER_PWM
+};
+
+/**
+ * BUZZER Definitions
+ */
+constexpr size_t BUZZER_PWM_ID = 5;
+
+#define LED_GPIO_Port   GPIOC
+#define LED_Pin         GPIO_PIN_0
+#define LED_PERIPHERAL
+
+#define TIM_Control htim7
+
+#endif
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_HOSTSIM_BUS_H
+#define FINEMOTE_HOSTSIM_BUS_H
+
+#include <functional>
+
+#include "HostSim_HAL.h"
+
+#define HOSTSIM_CAN_FILTER_BANKS 28
+#define HOSTSIM_CAN_RX_FIFO_DEPTH 3
+#define HOSTSIM_CAN_FRAMES_PER_TICK 8   // 1Mbps下每毫秒约可传输8帧扩展数据帧
+#define HOSTSIM_CAN_BUS_COUNT 2
+#define HOSTSIM_UART_BUS_COUNT 8
+#define HOSTSIM_I2C_BUS_COUNT 3
+#define HOSTSIM_I2C_STALL_CLOCKS 5      // 拉住总线的从机在收到该数量的SCL时钟后送完当前字节并释放SDA
+#define HOSTSIM_SPI_BUS_COUNT 3
+
+typedef struct {
+    uint32_t id;
+    uint8_t IDE;
+    uint8_t RTR;
+    uint8_t DLC;
+    uint8_t data[8];
+} HostSim_CANFrame_t;
+
+typedef struct {
+    uint32_t txFrames;
+    uint32_t rxFrames;
+    uint32_t rxFiltered;    // 未通过硬件过滤器而被丢弃的帧数
+    uint32_t rxOverrun;     // FIFO满时被覆盖的帧数
+} HostSim_CANStats_t;
+
+typedef struct {
+    uint32_t txBytes;
+    uint32_t rxBytes;
+    uint32_t rxDropped;     // 未处于接收状态时到达而被丢弃的字节数
+} HostSim_UARTStats_t;
+
+/**
+ * 虚拟I2C从机看到的一次传输，读传输中由从机填写data
+ */
+typedef struct {
+    uint8_t addr;       // 7位地址
+    bool read;
+    bool mem;           // 是否先写入寄存器地址reg
+    uint8_t reg;
+    uint8_t *data;
+    uint16_t size;
+} HostSim_I2CTransfer_t;
+
+enum class HostSim_I2CResponse_e : uint8_t {
+    Ack,
+    Nack,       // 从机无应答，传输以HAL_I2C_ERROR_AF结束
+    Stall,      // 从机拉低SDA，传输不会结束且BUSY标志保持；重新初始化外设不能释放，需在SCL上补发时钟
+};
+
+typedef struct {
+    uint32_t transfers;
+    uint32_t nacks;
+    uint32_t stalls;
+    uint32_t recoveryClocks;    // 引脚为GPIO时SCL上的上升沿数，包括产生STOP时的一个
+    uint32_t busyStarts;        // BUSY置位时调用的启动函数数，目标板上每次在其中忙等至多25ms
+    uint32_t maskedStarts;      // 屏蔽中断时调用的启动函数数
+} HostSim_I2CStats_t;
+
+/**
+ * 虚拟SPI从机看到的一次传输，从机按片选引脚的输出电平判断是否被选中，并向rx写入应答
+ */
+typedef struct {
+    const uint8_t *tx;  // 只接收时为接收缓冲区中原有的内容
+    uint8_t *rx;        // 只发送时为nullptr
+    uint16_t size;
+    uint32_t CR1;       // 传输时外设的时钟分频与模式配置
+    bool error;         // 由从机置位时传输以溢出错误结束，模拟传输失败
+} HostSim_SPITransfer_t;
+
+typedef struct {
+    uint32_t transfers;
+    uint32_t bytes;
+} HostSim_SPIStats_t;
+
+/**
+ * 主机仿真的时间与虚拟总线控制接口
+ * @note 仿真时间只在Tick()中推进，每个Tick依次触发HAL时基、TIM_Control控制中断与各总线的发送进度，
+ *       HAL_Delay()会在等待期间持续调用Tick()，因此Loop()中的延时与目标板上被定时中断抢占的效果一致
+ */
+class HostSim {
+public:
+    /*** 仿真时间 ***/
+
+    static void Tick();
+
+    static void Run(uint32_t ms);
+
+    /**
+     * @param ms 仿真总时长，0表示不限时长
+     */
+    static void SetDuration(uint32_t ms);
+
+    /**
+     * @param realTime 为true时每个Tick按墙钟时间对齐，否则全速运行
+     */
+    static void SetRealTime(bool realTime);
+
+    static bool IsRunning();
+
+    /**
+     * 控制中断(TIM_Control)中累计的墙钟时间，单位为纳秒
+     */
+    static uint64_t GetControlTime();
+
+    /*** 虚拟CAN总线，bus与BSP_CANList中的编号一致 ***/
+
+    /**
+     * 模拟总线上其他节点发出一帧，经硬件过滤器后进入接收FIFO并触发接收中断
+     */
+    static void CAN_Inject(uint8_t bus, const HostSim_CANFrame_t &frame);
+
+    /**
+     * 设置总线上其他节点的行为，每帧发送完成时调用，可在其中调用CAN_Inject模拟应答
+     */
+    static void CAN_SetTxHook(uint8_t bus, std::function<void(const HostSim_CANFrame_t &)> hook);
+
+    static const HostSim_CANStats_t &CAN_GetStats(uint8_t bus);
+
+    /*** 虚拟UART，bus与BSP_UARTList中的编号一致 ***/
+
+    static void UART_Inject(uint8_t bus, const uint8_t *data, size_t size);
+
+    static void UART_SetTxHook(uint8_t bus, std::function<void(const uint8_t *, size_t)> hook);
+
+    static const HostSim_UARTStats_t &UART_GetStats(uint8_t bus);
+
+    /*** 虚拟I2C，bus与BSP_I2CList中的编号一致 ***/
+
+    /**
+     * 设置总线上的从机，每次传输按时钟频率经过相应时间后调用；未设置时所有传输均无应答
+     */
+    static void I2C_SetDevice(uint8_t bus, std::function<HostSim_I2CResponse_e(HostSim_I2CTransfer_t &)> device);
+
+    /**
+     * 设置从机拉住总线后释放SDA所需的SCL时钟数，默认为HOSTSIM_I2C_STALL_CLOCKS；超过9时单次恢复无法释放总线
+     */
+    static void I2C_SetStallClocks(uint8_t bus, uint32_t clocks);
+
+    static const HostSim_I2CStats_t &I2C_GetStats(uint8_t bus);
+
+    /*** 虚拟SPI，bus与BSP_SPIList中的编号一致 ***/
+
+    /**
+     * 设置总线上的从机，每次传输按时钟频率经过相应时间后调用；未设置时接收到的数据不变
+     */
+    static void SPI_SetDevice(uint8_t bus, std::function<void(HostSim_SPITransfer_t &)> device);
+
+    static const HostSim_SPIStats_t &SPI_GetStats(uint8_t bus);
+
+    /*** 虚拟GPIO ***/
+
+    static void GPIO_SetInput(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+
+    /**
+     * 设置输出电平变化时的回调，用于模拟片选等由软件驱动的信号
+     */
+    static void GPIO_SetOutputHook(std::function<void(GPIO_TypeDef *, uint16_t, GPIO_PinState)> hook);
+};
+
+#endif
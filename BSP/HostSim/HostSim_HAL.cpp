@@ -0,0 +1,1067 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <chrono>
+#include <thread>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+
+GPIO_TypeDef HostSim_GPIO[9] = {};
+TIM_TypeDef HostSim_TIM[15] = {};
+CAN_TypeDef HostSim_CAN[3] = {{0, 0}, {1, 0}, {2, 0}};
+USART_TypeDef HostSim_USART[9] = {{0}, {1}, {2}, {3}, {4}, {5}, {6}, {7}, {8}};
+I2C_TypeDef HostSim_I2C[4] = {{0}, {1}, {2}, {3}};
+SPI_TypeDef HostSim_SPI[4] = {{0}, {1}, {2}, {3}};
+
+namespace {
+
+typedef struct {
+    bool active;
+    uint32_t mode;
+    uint32_t scale;
+    uint32_t fifo;
+    uint32_t FR1;
+    uint32_t FR2;
+} FilterBank_t;
+
+struct CANState {
+    bool started = false;
+    uint32_t activeITs = 0;
+    HostSim_CANFrame_t mailbox[3] = {};
+    bool mailboxPending[3] = {};
+    uint32_t mailboxRequest[3] = {};    // 发送请求的序号，TXFP置位时按请求顺序发送
+    uint32_t txRequests = 0;
+    HostSim_CANFrame_t fifo[2][HOSTSIM_CAN_RX_FIFO_DEPTH] = {};
+    uint8_t fifoHead[2] = {};
+    uint8_t fifoCount[2] = {};
+    std::function<void(const HostSim_CANFrame_t &)> txHook;
+    HostSim_CANStats_t stats = {};
+};
+
+struct UARTState {
+    const uint8_t *txData = nullptr;
+    uint16_t txSize = 0;
+    uint32_t txCredit = 0;      // 按波特率累计的可发送位数
+    bool txBusy = false;
+    bool txDMA = false;
+    uint8_t *rxData = nullptr;
+    uint16_t rxSize = 0;
+    bool rxArmed = false;
+    bool rxCircular = false;
+    uint16_t rxPos = 0;         // 循环DMA的写入位置
+    std::function<void(const uint8_t *, size_t)> txHook;
+    HostSim_UARTStats_t stats = {};
+};
+
+enum class I2CDone_e : uint8_t {
+    MasterTx,
+    MasterRx,
+    MemTx,
+    MemRx,
+};
+
+struct I2CState {
+    bool busy = false;
+    bool stalled = false;
+    HostSim_I2CTransfer_t transfer = {};
+    I2CDone_e done = I2CDone_e::MasterTx;
+    uint32_t bits = 0;          // 本次传输的总时钟数
+    uint32_t credit = 0;        // 按时钟频率累计的可传输位数
+    bool gpio = false;          // SCL与SDA已切换为通用输出，由HAL_I2C_Init恢复为复用功能
+    uint32_t stallClocks = HOSTSIM_I2C_STALL_CLOCKS;
+    uint32_t releaseClocks = 0; // 从机释放SDA前还需的SCL时钟数
+    std::function<HostSim_I2CResponse_e(HostSim_I2CTransfer_t &)> device;
+    HostSim_I2CStats_t stats = {};
+};
+
+enum class SPIDone_e : uint8_t {
+    TxRx,
+    Tx,
+    Rx,
+};
+
+struct SPIState {
+    bool busy = false;
+    HostSim_SPITransfer_t transfer = {};
+    SPIDone_e done = SPIDone_e::TxRx;
+    uint32_t credit = 0;        // 按时钟频率累计的可传输位数
+    std::function<void(HostSim_SPITransfer_t &)> device;
+    HostSim_SPIStats_t stats = {};
+};
+
+/**
+ * 仿真状态使用函数内静态变量，保证在其他编译单元的全局对象构造期间首次访问时即已初始化
+ */
+struct SimState {
+    uint32_t tick = 0;
+    uint32_t duration = 0;
+    bool realTime = false;
+    bool timControlStarted = false;
+    uint32_t tickDepth = 0;
+    uint32_t primask = 0;
+    uint64_t controlTime = 0;
+    std::chrono::steady_clock::time_point wallStart = std::chrono::steady_clock::now();
+    FilterBank_t filterBanks[HOSTSIM_CAN_FILTER_BANKS] = {};
+    uint32_t slaveStartFilterBank = 14;
+    CANState can[HOSTSIM_CAN_BUS_COUNT + 1];
+    UARTState uart[HOSTSIM_UART_BUS_COUNT + 1];
+    I2CState i2c[HOSTSIM_I2C_BUS_COUNT + 1];
+    SPIState spi[HOSTSIM_SPI_BUS_COUNT + 1];
+    std::function<void(GPIO_TypeDef *, uint16_t, GPIO_PinState)> gpioOutputHook;
+};
+
+SimState &Sim() {
+    static SimState state;
+    return state;
+}
+
+TIM_HandleTypeDef htimBase = {TIM9};
+
+CAN_HandleTypeDef *CANHandle(uint8_t bus) {
+    return bus < sizeof(BSP_CANList) / sizeof(BSP_CANList[0]) ? BSP_CANList[bus] : nullptr;
+}
+
+UART_HandleTypeDef *UARTHandle(uint8_t bus) {
+    return bus < sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) ? BSP_UARTList[bus] : nullptr;
+}
+
+I2C_HandleTypeDef *I2CHandle(uint8_t bus) {
+    return bus < sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]) ? BSP_I2CList[bus] : nullptr;
+}
+
+/**
+ * 空闲时SDA与SCL由上拉保持高电平，从机拉住总线时SDA为低
+ */
+void UpdateI2CLines(uint8_t bus) {
+    HostSim::GPIO_SetInput(BSP_I2CSCLPortList[bus], BSP_I2CSCLPinList[bus], GPIO_PIN_SET);
+    HostSim::GPIO_SetInput(BSP_I2CSDAPortList[bus], BSP_I2CSDAPinList[bus],
+                           Sim().i2c[bus].stalled ? GPIO_PIN_RESET : GPIO_PIN_SET);
+}
+
+/**
+ * SCL作为通用输出时的上升沿，拉住总线的从机每个时钟送出一位，送完当前字节后释放SDA
+ */
+void ClockI2C(GPIO_TypeDef *port, uint16_t pin) {
+    for (uint8_t bus = 1; bus < sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]); ++bus) {
+        I2CState &i2c = Sim().i2c[bus];
+        if (BSP_I2CList[bus] == nullptr || !i2c.gpio || BSP_I2CSCLPortList[bus] != port ||
+            (BSP_I2CSCLPinList[bus] & pin) == 0) {
+            continue;
+        }
+        i2c.stats.recoveryClocks++;
+        if (i2c.stalled && --i2c.releaseClocks == 0) {
+            i2c.stalled = false;
+            UpdateI2CLines(bus);
+        }
+    }
+}
+
+SPI_HandleTypeDef *SPIHandle(uint8_t bus) {
+    return bus < sizeof(BSP_SPIList) / sizeof(BSP_SPIList[0]) ? BSP_SPIList[bus] : nullptr;
+}
+
+/**
+ * 按bxCAN过滤器寄存器格式生成帧的标识符映像
+ */
+uint32_t FilterImage32(const HostSim_CANFrame_t &frame) {
+    if (frame.IDE == CAN_ID_EXT) {
+        return (frame.id << 3) | CAN_ID_EXT | (frame.RTR ? CAN_RTR_REMOTE : 0);
+    }
+    return (frame.id << 21) | (frame.RTR ? CAN_RTR_REMOTE : 0);
+}
+
+uint32_t FilterImage16(const HostSim_CANFrame_t &frame) {
+    if (frame.IDE == CAN_ID_EXT) {
+        return ((frame.id >> 18) << 5) | (frame.RTR ? 0x10 : 0) | 0x08 | ((frame.id >> 15) & 0x07);
+    }
+    return (frame.id << 5) | (frame.RTR ? 0x10 : 0);
+}
+
+bool FilterMatch(const FilterBank_t &bank, const HostSim_CANFrame_t &frame) {
+    if (bank.scale == CAN_FILTERSCALE_32BIT) {
+        uint32_t image = FilterImage32(frame);
+        if (bank.mode == CAN_FILTERMODE_IDMASK) {
+            return ((image ^ bank.FR1) & bank.FR2) == 0;
+        }
+        return image == bank.FR1 || image == bank.FR2;
+    }
+
+    uint32_t image = FilterImage16(frame);
+    if (bank.mode == CAN_FILTERMODE_IDMASK) {
+        return ((image ^ (bank.FR1 & 0xFFFF)) & (bank.FR1 >> 16)) == 0 ||
+               ((image ^ (bank.FR2 & 0xFFFF)) & (bank.FR2 >> 16)) == 0;
+    }
+    return image == (bank.FR1 & 0xFFFF) || image == (bank.FR1 >> 16) ||
+           image == (bank.FR2 & 0xFFFF) || image == (bank.FR2 >> 16);
+}
+
+/**
+ * 接收中断为电平触发，FIFO非空时持续进入回调，回调未取出数据时停止以避免死循环
+ */
+void DispatchRx(uint8_t bus) {
+    CANState &can = Sim().can[bus];
+    const uint32_t pendingIT[2] = {CAN_IT_RX_FIFO0_MSG_PENDING, CAN_IT_RX_FIFO1_MSG_PENDING};
+    for (uint32_t f = 0; f < 2; ++f) {
+        while (can.fifoCount[f] > 0 && (can.activeITs & pendingIT[f])) {
+            uint8_t before = can.fifoCount[f];
+            if (f == 0) {
+                HAL_CAN_RxFifo0MsgPendingCallback(CANHandle(bus));
+            } else {
+                HAL_CAN_RxFifo1MsgPendingCallback(CANHandle(bus));
+            }
+            if (can.fifoCount[f] >= before) {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * 与bxCAN一致，TXFP清零时按标识符仲裁顺序、标识符相同时按邮箱编号发送，TXFP置位时按请求顺序发送；
+ * 每帧完成后触发发送完成中断，回调中装填的新帧可在同一Tick内继续发送
+ */
+void ProgressCAN(uint8_t bus) {
+    CANState &can = Sim().can[bus];
+    const bool fifoPriority = CANHandle(bus)->Instance->MCR & CAN_MCR_TXFP;
+    for (uint32_t n = 0; n < HOSTSIM_CAN_FRAMES_PER_TICK; ++n) {
+        int index = -1;
+        uint32_t bestKey = 0;
+        for (int i = 0; i < 3; ++i) {
+            if (!can.mailboxPending[i]) {
+                continue;
+            }
+            const HostSim_CANFrame_t &frame = can.mailbox[i];
+            uint32_t key = fifoPriority ? can.mailboxRequest[i] - can.txRequests
+                                        : frame.IDE == CAN_ID_EXT ? (frame.id << 1) | 1 : frame.id << 19;
+            if (index < 0 || key < bestKey) {
+                index = i;
+                bestKey = key;
+            }
+        }
+        if (index < 0) {
+            return;
+        }
+
+        HostSim_CANFrame_t frame = can.mailbox[index];
+        can.mailboxPending[index] = false;
+        can.stats.txFrames++;
+        if (can.txHook) {
+            can.txHook(frame);
+        }
+        if (can.activeITs & CAN_IT_TX_MAILBOX_EMPTY) {
+            switch (index) {
+                case 0: HAL_CAN_TxMailbox0CompleteCallback(CANHandle(bus));
+                    break;
+                case 1: HAL_CAN_TxMailbox1CompleteCallback(CANHandle(bus));
+                    break;
+                case 2: HAL_CAN_TxMailbox2CompleteCallback(CANHandle(bus));
+                    break;
+            }
+        }
+    }
+}
+
+void ProgressUART(uint8_t bus) {
+    UARTState &uart = Sim().uart[bus];
+    if (!uart.txBusy) {
+        return;
+    }
+    // 每字节10位，每Tick为1ms
+    uart.txCredit += UARTHandle(bus)->Init.BaudRate / 1000;
+    if (uart.txCredit < static_cast<uint32_t>(uart.txSize) * 10) {
+        return;
+    }
+    uart.txCredit = 0;
+    uart.txBusy = false;
+    uart.stats.txBytes += uart.txSize;
+    if (uart.txHook) {
+        uart.txHook(uart.txData, uart.txSize);
+    }
+    // 中断模式每字节一次TXE中断，DMA模式为DMA传输完成中断，两者最后均有一次TC中断
+    uint32_t irqs = uart.txDMA ? 1 : uart.txSize;
+    for (uint32_t i = 0; i < irqs; ++i) {
+        BSP_UART_IRQHook(UARTHandle(bus));
+    }
+    BSP_UART_IRQHook(UARTHandle(bus));
+    HAL_UART_TxCpltCallback(UARTHandle(bus));
+}
+
+/**
+ * 每字节9个时钟；寄存器读写先写入寄存器地址，读操作还需重复起始并再次发送地址
+ */
+HAL_StatusTypeDef StartI2C(I2C_HandleTypeDef *hi2c, I2CDone_e done, uint16_t DevAddress, bool mem,
+                           uint16_t MemAddress, uint8_t *pData, uint16_t Size) {
+    I2CState &i2c = Sim().i2c[hi2c->Instance->Index];
+    if (Sim().primask != 0) {
+        i2c.stats.maskedStarts++;
+    }
+    if (i2c.busy) {
+        return HAL_BUSY;
+    }
+    if (hi2c->Instance->SR2 & I2C_SR2_BUSY) {
+        i2c.stats.busyStarts++;
+        return HAL_BUSY;
+    }
+    if (pData == nullptr || Size == 0) {
+        return HAL_ERROR;
+    }
+    bool read = done == I2CDone_e::MasterRx || done == I2CDone_e::MemRx;
+    i2c.transfer = {static_cast<uint8_t>(DevAddress >> 1), read, mem, static_cast<uint8_t>(MemAddress), pData, Size};
+    i2c.done = done;
+    i2c.bits = (Size + 1 + (mem ? 1 : 0) + (mem && read ? 1 : 0)) * 9;
+    i2c.busy = true;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    hi2c->Instance->SR2 |= I2C_SR2_BUSY;
+    return HAL_OK;
+}
+
+/**
+ * 完成回调中启动的下一次传输使用本Tick剩余的时钟，与目标板在完成中断中背靠背启动传输的效果一致
+ */
+void ProgressI2C(uint8_t bus) {
+    I2CState &i2c = Sim().i2c[bus];
+    I2C_HandleTypeDef *hi2c = I2CHandle(bus);
+    if (!i2c.busy || i2c.stalled) {
+        i2c.credit = 0;
+        return;
+    }
+    i2c.credit += hi2c->Init.ClockSpeed / 1000;
+    while (i2c.busy && !i2c.stalled && i2c.credit >= i2c.bits) {
+        i2c.credit -= i2c.bits;
+        HostSim_I2CResponse_e response = i2c.device ? i2c.device(i2c.transfer) : HostSim_I2CResponse_e::Nack;
+        if (response == HostSim_I2CResponse_e::Stall) {
+            i2c.stalled = true;
+            i2c.releaseClocks = i2c.stallClocks;
+            i2c.stats.stalls++;
+            UpdateI2CLines(bus);
+            break;
+        }
+        i2c.busy = false;
+        hi2c->Instance->SR2 &= ~I2C_SR2_BUSY;
+        if (response == HostSim_I2CResponse_e::Nack) {
+            i2c.stats.nacks++;
+            hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+            HAL_I2C_ErrorCallback(hi2c);
+            continue;
+        }
+        i2c.stats.transfers++;
+        switch (i2c.done) {
+            case I2CDone_e::MasterTx:
+                HAL_I2C_MasterTxCpltCallback(hi2c);
+                break;
+            case I2CDone_e::MasterRx:
+                HAL_I2C_MasterRxCpltCallback(hi2c);
+                break;
+            case I2CDone_e::MemTx:
+                HAL_I2C_MemTxCpltCallback(hi2c);
+                break;
+            case I2CDone_e::MemRx:
+                HAL_I2C_MemRxCpltCallback(hi2c);
+                break;
+        }
+    }
+    if (!i2c.busy) {
+        i2c.credit = 0;
+    }
+}
+
+HAL_StatusTypeDef StartSPI(SPI_HandleTypeDef *hspi, SPIDone_e done, const uint8_t *pTxData, uint8_t *pRxData,
+                           uint16_t Size) {
+    SPIState &spi = Sim().spi[hspi->Instance->Index];
+    if (spi.busy) {
+        return HAL_BUSY;
+    }
+    if (Size == 0 || (done != SPIDone_e::Tx && pRxData == nullptr) || (done != SPIDone_e::Rx && pTxData == nullptr)) {
+        return HAL_ERROR;
+    }
+    hspi->Instance->CR1 |= SPI_CR1_SPE;
+    spi.transfer = {done == SPIDone_e::Rx ? pRxData : pTxData, pRxData, Size, hspi->Instance->CR1, false};
+    spi.done = done;
+    spi.busy = true;
+    hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+    return HAL_OK;
+}
+
+/**
+ * SPI1挂在84MHz的APB2上，SPI2与SPI3挂在42MHz的APB1上；完成回调中启动的下一次传输使用本Tick剩余的时钟
+ */
+void ProgressSPI(uint8_t bus) {
+    SPIState &spi = Sim().spi[bus];
+    SPI_HandleTypeDef *hspi = SPIHandle(bus);
+    if (!spi.busy) {
+        spi.credit = 0;
+        return;
+    }
+    uint32_t pclk = bus == 1 ? 84000000u : 42000000u;
+    spi.credit += (pclk >> (((hspi->Instance->CR1 & SPI_CR1_BR) >> 3) + 1)) / 1000;
+    while (spi.busy && spi.credit >= spi.transfer.size * 8u) {
+        spi.credit -= spi.transfer.size * 8u;
+        if (spi.device) {
+            spi.device(spi.transfer);
+        }
+        spi.busy = false;
+        spi.stats.transfers++;
+        spi.stats.bytes += spi.transfer.size;
+        if (spi.transfer.error) {
+            hspi->ErrorCode = HAL_SPI_ERROR_OVR;
+            HAL_SPI_ErrorCallback(hspi);
+            continue;
+        }
+        switch (spi.done) {
+            case SPIDone_e::TxRx:
+                HAL_SPI_TxRxCpltCallback(hspi);
+                break;
+            case SPIDone_e::Tx:
+                HAL_SPI_TxCpltCallback(hspi);
+                break;
+            case SPIDone_e::Rx:
+                HAL_SPI_RxCpltCallback(hspi);
+                break;
+        }
+    }
+    if (!spi.busy) {
+        spi.credit = 0;
+    }
+}
+
+}
+
+/*** 仿真时间 ***/
+
+void HostSim::Tick() {
+    SimState &sim = Sim();
+    sim.tickDepth++;
+
+    HAL_TIM_PeriodElapsedCallback(&htimBase);
+    if (sim.timControlStarted) {
+        auto start = std::chrono::steady_clock::now();
+        HAL_TIM_PeriodElapsedCallback(&TIM_Control);
+        sim.controlTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+
+    for (uint8_t bus = 1; bus <= HOSTSIM_CAN_BUS_COUNT; ++bus) {
+        if (CANHandle(bus) != nullptr) {
+            ProgressCAN(bus);
+        }
+    }
+    for (uint8_t bus = 1; bus <= HOSTSIM_UART_BUS_COUNT; ++bus) {
+        if (UARTHandle(bus) != nullptr) {
+            ProgressUART(bus);
+        }
+    }
+    for (uint8_t bus = 1; bus <= HOSTSIM_I2C_BUS_COUNT; ++bus) {
+        if (I2CHandle(bus) != nullptr) {
+            ProgressI2C(bus);
+        }
+    }
+    for (uint8_t bus = 1; bus <= HOSTSIM_SPI_BUS_COUNT; ++bus) {
+        if (SPIHandle(bus) != nullptr) {
+            ProgressSPI(bus);
+        }
+    }
+
+    sim.tickDepth--;
+
+    if (sim.realTime) {
+        std::this_thread::sleep_until(sim.wallStart + std::chrono::milliseconds(sim.tick));
+    }
+}
+
+void HostSim::Run(uint32_t ms) {
+    for (uint32_t i = 0; i < ms && IsRunning(); ++i) {
+        Tick();
+    }
+}
+
+void HostSim::SetDuration(uint32_t ms) {
+    Sim().duration = ms;
+}
+
+void HostSim::SetRealTime(bool realTime) {
+    Sim().realTime = realTime;
+    Sim().wallStart = std::chrono::steady_clock::now() - std::chrono::milliseconds(Sim().tick);
+}
+
+bool HostSim::IsRunning() {
+    return Sim().duration == 0 || Sim().tick < Sim().duration;
+}
+
+uint64_t HostSim::GetControlTime() {
+    return Sim().controlTime;
+}
+
+/*** 虚拟CAN总线 ***/
+
+void HostSim::CAN_Inject(uint8_t bus, const HostSim_CANFrame_t &frame) {
+    if (CANHandle(bus) == nullptr || !Sim().can[bus].started) {
+        return;
+    }
+    SimState &sim = Sim();
+    CANState &can = sim.can[bus];
+
+    uint32_t first = bus == 1 ? 0 : sim.slaveStartFilterBank;
+    uint32_t last = bus == 1 ? sim.slaveStartFilterBank : HOSTSIM_CAN_FILTER_BANKS;
+    // 与bxCAN的过滤器优先级一致：32位组优先于16位组，同位宽时列表模式优先于掩码模式，其余按组号从小到大
+    int fifo = -1;
+    uint32_t bestRank = 0;
+    for (uint32_t i = first; i < last; ++i) {
+        const FilterBank_t &bank = sim.filterBanks[i];
+        if (!bank.active || !FilterMatch(bank, frame)) {
+            continue;
+        }
+        uint32_t rank = (bank.scale == CAN_FILTERSCALE_32BIT ? 2 : 0) + (bank.mode == CAN_FILTERMODE_IDLIST ? 1 : 0);
+        if (fifo < 0 || rank > bestRank) {
+            fifo = static_cast<int>(bank.fifo);
+            bestRank = rank;
+        }
+    }
+    if (fifo < 0) {
+        can.stats.rxFiltered++;
+        return;
+    }
+
+    can.stats.rxFrames++;
+    if (can.fifoCount[fifo] == HOSTSIM_CAN_RX_FIFO_DEPTH) {
+        // 与bxCAN非锁定模式一致，FIFO满时新帧覆盖最后一帧
+        can.stats.rxOverrun++;
+        can.fifo[fifo][(can.fifoHead[fifo] + HOSTSIM_CAN_RX_FIFO_DEPTH - 1) % HOSTSIM_CAN_RX_FIFO_DEPTH] = frame;
+        if (can.activeITs & (fifo == 0 ? CAN_IT_RX_FIFO0_OVERRUN : CAN_IT_RX_FIFO1_OVERRUN)) {
+            CANHandle(bus)->ErrorCode |= fifo == 0 ? HAL_CAN_ERROR_RX_FOV0 : HAL_CAN_ERROR_RX_FOV1;
+            HAL_CAN_ErrorCallback(CANHandle(bus));
+        }
+    } else {
+        can.fifo[fifo][(can.fifoHead[fifo] + can.fifoCount[fifo]) % HOSTSIM_CAN_RX_FIFO_DEPTH] = frame;
+        can.fifoCount[fifo]++;
+    }
+    DispatchRx(bus);
+}
+
+void HostSim::CAN_SetTxHook(uint8_t bus, std::function<void(const HostSim_CANFrame_t &)> hook) {
+    Sim().can[bus].txHook = std::move(hook);
+}
+
+const HostSim_CANStats_t &HostSim::CAN_GetStats(uint8_t bus) {
+    return Sim().can[bus].stats;
+}
+
+/*** 虚拟UART ***/
+
+/**
+ * 数据一次性到达，填满接收缓冲区或数据结束(空闲)时触发接收事件，未开启接收时到达的数据被丢弃
+ * 循环DMA模式下按HAL的行为在半满、全满与空闲时触发接收事件，事件参数为写入位置
+ */
+void HostSim::UART_Inject(uint8_t bus, const uint8_t *data, size_t size) {
+    UART_HandleTypeDef *huart = UARTHandle(bus);
+    if (huart == nullptr) {
+        return;
+    }
+    UARTState &uart = Sim().uart[bus];
+    if (uart.rxCircular) {
+        for (size_t i = 0; i < size; ++i) {
+            uart.rxData[uart.rxPos++] = data[i];
+            uart.stats.rxBytes++;
+            if (uart.rxPos == uart.rxSize / 2 || uart.rxPos == uart.rxSize) {
+                huart->hdmarx->Instance->NDTR = uart.rxPos == uart.rxSize ? uart.rxSize : uart.rxSize - uart.rxPos;
+                huart->RxEventType = uart.rxPos == uart.rxSize ? HAL_UART_RXEVENT_TC : HAL_UART_RXEVENT_HT;
+                BSP_UART_IRQHook(huart);
+                HAL_UARTEx_RxEventCallback(huart, uart.rxPos);
+                uart.rxPos %= uart.rxSize;
+            }
+        }
+        huart->hdmarx->Instance->NDTR = uart.rxSize - uart.rxPos;
+        huart->Instance->SR |= UART_FLAG_IDLE;
+        BSP_UART_IRQHook(huart);
+        huart->Instance->SR &= ~UART_FLAG_IDLE;
+        if (uart.rxPos > 0) {
+            huart->RxEventType = HAL_UART_RXEVENT_IDLE;
+            HAL_UARTEx_RxEventCallback(huart, uart.rxPos);
+        }
+        return;
+    }
+    while (size > 0) {
+        if (!uart.rxArmed) {
+            uart.stats.rxDropped += size;
+            return;
+        }
+        uint16_t n = size < uart.rxSize ? static_cast<uint16_t>(size) : uart.rxSize;
+        memcpy(uart.rxData, data, n);
+        uart.rxArmed = false;
+        uart.stats.rxBytes += n;
+        // 每字节一次RXNE中断，空闲时再有一次IDLE中断
+        for (uint16_t i = 0; i <= n; ++i) {
+            BSP_UART_IRQHook(huart);
+        }
+        huart->RxEventType = n == uart.rxSize ? HAL_UART_RXEVENT_TC : HAL_UART_RXEVENT_IDLE;
+        HAL_UARTEx_RxEventCallback(huart, n);
+        data += n;
+        size -= n;
+    }
+}
+
+void HostSim::UART_SetTxHook(uint8_t bus, std::function<void(const uint8_t *, size_t)> hook) {
+    Sim().uart[bus].txHook = std::move(hook);
+}
+
+const HostSim_UARTStats_t &HostSim::UART_GetStats(uint8_t bus) {
+    return Sim().uart[bus].stats;
+}
+
+/*** 虚拟I2C ***/
+
+void HostSim::I2C_SetDevice(uint8_t bus, std::function<HostSim_I2CResponse_e(HostSim_I2CTransfer_t &)> device) {
+    Sim().i2c[bus].device = std::move(device);
+}
+
+void HostSim::I2C_SetStallClocks(uint8_t bus, uint32_t clocks) {
+    Sim().i2c[bus].stallClocks = clocks > 0 ? clocks : 1;
+}
+
+const HostSim_I2CStats_t &HostSim::I2C_GetStats(uint8_t bus) {
+    return Sim().i2c[bus].stats;
+}
+
+/*** 虚拟SPI ***/
+
+void HostSim::SPI_SetDevice(uint8_t bus, std::function<void(HostSim_SPITransfer_t &)> device) {
+    Sim().spi[bus].device = std::move(device);
+}
+
+const HostSim_SPIStats_t &HostSim::SPI_GetStats(uint8_t bus) {
+    return Sim().spi[bus].stats;
+}
+
+/*** 虚拟GPIO ***/
+
+void HostSim::GPIO_SetInput(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {
+    if (state == GPIO_PIN_SET) {
+        port->IDR |= pin;
+    } else {
+        port->IDR &= ~static_cast<uint32_t>(pin);
+    }
+}
+
+void HostSim::GPIO_SetOutputHook(std::function<void(GPIO_TypeDef *, uint16_t, GPIO_PinState)> hook) {
+    Sim().gpioOutputHook = std::move(hook);
+}
+
+/*** HAL ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t HAL_GetTick() {
+    return Sim().tick;
+}
+
+void HAL_IncTick() {
+    Sim().tick++;
+}
+
+/**
+ * 在延时期间推进仿真时间；在定时中断内调用时只推进时基，避免控制中断重入
+ */
+void HAL_Delay(uint32_t Delay) {
+    if (Sim().tickDepth > 0) {
+        Sim().tick += Delay;
+        return;
+    }
+    uint32_t start = HAL_GetTick();
+    while (HAL_GetTick() - start < Delay && HostSim::IsRunning()) {
+        HostSim::Tick();
+    }
+}
+
+uint32_t __get_PRIMASK() {
+    return Sim().primask;
+}
+
+void __set_PRIMASK(uint32_t priMask) {
+    Sim().primask = priMask;
+}
+
+void __disable_irq() {
+    Sim().primask = 1;
+}
+
+/**
+ * I2C的SCL与SDA配置为通用输出时记录下来，此后SCL上的上升沿视为总线恢复的补发时钟
+ */
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init) {
+    if (GPIO_Init->Mode != GPIO_MODE_OUTPUT_OD && GPIO_Init->Mode != GPIO_MODE_OUTPUT_PP) {
+        return;
+    }
+    for (uint8_t bus = 1; bus < sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]); ++bus) {
+        if (BSP_I2CList[bus] != nullptr && BSP_I2CSCLPortList[bus] == GPIOx && (BSP_I2CSCLPinList[bus] & GPIO_Init->Pin)) {
+            Sim().i2c[bus].gpio = true;
+        }
+    }
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin) {}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+    bool rising = PinState == GPIO_PIN_SET && (GPIOx->ODR & GPIO_Pin) != GPIO_Pin;
+    bool changed = (GPIOx->ODR & GPIO_Pin) != (PinState == GPIO_PIN_SET ? GPIO_Pin : 0u);
+    if (PinState == GPIO_PIN_SET) {
+        GPIOx->ODR |= GPIO_Pin;
+    } else {
+        GPIOx->ODR &= ~static_cast<uint32_t>(GPIO_Pin);
+    }
+    if (rising) {
+        ClockI2C(GPIOx, GPIO_Pin);
+    }
+    if (changed && Sim().gpioOutputHook) {
+        Sim().gpioOutputHook(GPIOx, GPIO_Pin, PinState);
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+    return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+    GPIOx->ODR ^= GPIO_Pin;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim) {
+    if (htim == &TIM_Control) {
+        Sim().timControlStarted = true;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t Channel) {
+    __HAL_TIM_SET_COMPARE(htim, Channel, 0);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_IWDG_Refresh(IWDG_HandleTypeDef *hiwdg) {
+    hiwdg->RefreshCount++;
+    return HAL_OK;
+}
+
+/**
+ * 与HAL相同的寄存器映像：32位模式下FR1为ID、FR2为掩码或第二个ID；16位模式下每个寄存器高16位为掩码或第二个ID
+ */
+HAL_StatusTypeDef HAL_CAN_ConfigFilter(CAN_HandleTypeDef *hcan, const CAN_FilterTypeDef *sFilterConfig) {
+    if (sFilterConfig->FilterBank >= HOSTSIM_CAN_FILTER_BANKS) {
+        return HAL_ERROR;
+    }
+    SimState &sim = Sim();
+    sim.slaveStartFilterBank = sFilterConfig->SlaveStartFilterBank;
+
+    FilterBank_t &bank = sim.filterBanks[sFilterConfig->FilterBank];
+    bank.mode = sFilterConfig->FilterMode;
+    bank.scale = sFilterConfig->FilterScale;
+    bank.fifo = sFilterConfig->FilterFIFOAssignment;
+    if (bank.scale == CAN_FILTERSCALE_32BIT) {
+        bank.FR1 = (sFilterConfig->FilterIdHigh & 0xFFFF) << 16 | (sFilterConfig->FilterIdLow & 0xFFFF);
+        bank.FR2 = (sFilterConfig->FilterMaskIdHigh & 0xFFFF) << 16 | (sFilterConfig->FilterMaskIdLow & 0xFFFF);
+    } else {
+        bank.FR1 = (sFilterConfig->FilterMaskIdLow & 0xFFFF) << 16 | (sFilterConfig->FilterIdLow & 0xFFFF);
+        bank.FR2 = (sFilterConfig->FilterMaskIdHigh & 0xFFFF) << 16 | (sFilterConfig->FilterIdHigh & 0xFFFF);
+    }
+    bank.active = sFilterConfig->FilterActivation == ENABLE;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_Start(CAN_HandleTypeDef *hcan) {
+    Sim().can[hcan->Instance->Index].started = true;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_ActivateNotification(CAN_HandleTypeDef *hcan, uint32_t ActiveITs) {
+    Sim().can[hcan->Instance->Index].activeITs |= ActiveITs;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_DeactivateNotification(CAN_HandleTypeDef *hcan, uint32_t InactiveITs) {
+    Sim().can[hcan->Instance->Index].activeITs &= ~InactiveITs;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_AddTxMessage(CAN_HandleTypeDef *hcan, const CAN_TxHeaderTypeDef *pHeader,
+                                       const uint8_t aData[], uint32_t *pTxMailbox) {
+    CANState &can = Sim().can[hcan->Instance->Index];
+    if (!can.started) {
+        return HAL_ERROR;
+    }
+    for (uint32_t i = 0; i < 3; ++i) {
+        if (!can.mailboxPending[i]) {
+            HostSim_CANFrame_t &frame = can.mailbox[i];
+            frame.IDE = static_cast<uint8_t>(pHeader->IDE);
+            frame.RTR = static_cast<uint8_t>(pHeader->RTR);
+            frame.id = pHeader->IDE == CAN_ID_EXT ? pHeader->ExtId : pHeader->StdId;
+            frame.DLC = static_cast<uint8_t>(pHeader->DLC > 8 ? 8 : pHeader->DLC);
+            memcpy(frame.data, aData, frame.DLC);
+            can.mailboxPending[i] = true;
+            can.mailboxRequest[i] = can.txRequests++;
+            *pTxMailbox = 1U << i;
+            return HAL_OK;
+        }
+    }
+    return HAL_ERROR;
+}
+
+uint32_t HAL_CAN_GetTxMailboxesFreeLevel(const CAN_HandleTypeDef *hcan) {
+    CANState &can = Sim().can[hcan->Instance->Index];
+    return !can.mailboxPending[0] + !can.mailboxPending[1] + !can.mailboxPending[2];
+}
+
+HAL_StatusTypeDef HAL_CAN_GetRxMessage(CAN_HandleTypeDef *hcan, uint32_t RxFifo, CAN_RxHeaderTypeDef *pHeader,
+                                       uint8_t aData[]) {
+    CANState &can = Sim().can[hcan->Instance->Index];
+    if (RxFifo > CAN_RX_FIFO1 || can.fifoCount[RxFifo] == 0) {
+        hcan->ErrorCode |= HAL_CAN_ERROR_PARAM;
+        return HAL_ERROR;
+    }
+    const HostSim_CANFrame_t &frame = can.fifo[RxFifo][can.fifoHead[RxFifo]];
+    pHeader->IDE = frame.IDE;
+    pHeader->RTR = frame.RTR;
+    pHeader->StdId = frame.IDE == CAN_ID_STD ? frame.id : 0;
+    pHeader->ExtId = frame.IDE == CAN_ID_EXT ? frame.id : 0;
+    pHeader->DLC = frame.DLC;
+    pHeader->Timestamp = HAL_GetTick();
+    pHeader->FilterMatchIndex = 0;
+    memcpy(aData, frame.data, frame.DLC);
+    can.fifoHead[RxFifo] = (can.fifoHead[RxFifo] + 1) % HOSTSIM_CAN_RX_FIFO_DEPTH;
+    can.fifoCount[RxFifo]--;
+    return HAL_OK;
+}
+
+uint32_t HAL_CAN_GetRxFifoFillLevel(const CAN_HandleTypeDef *hcan, uint32_t RxFifo) {
+    return RxFifo <= CAN_RX_FIFO1 ? Sim().can[hcan->Instance->Index].fifoCount[RxFifo] : 0;
+}
+
+uint32_t HAL_CAN_GetError(const CAN_HandleTypeDef *hcan) {
+    return hcan->ErrorCode;
+}
+
+HAL_StatusTypeDef HAL_CAN_ResetError(CAN_HandleTypeDef *hcan) {
+    hcan->ErrorCode = HAL_CAN_ERROR_NONE;
+    return HAL_OK;
+}
+
+__weak void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan) {}
+
+__weak void HAL_CAN_RxFifo1MsgPendingCallback(CAN_HandleTypeDef *hcan) {}
+
+__weak void HAL_CAN_TxMailbox0CompleteCallback(CAN_HandleTypeDef *hcan) {}
+
+__weak void HAL_CAN_TxMailbox1CompleteCallback(CAN_HandleTypeDef *hcan) {}
+
+__weak void HAL_CAN_TxMailbox2CompleteCallback(CAN_HandleTypeDef *hcan) {}
+
+__weak void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan) {}
+
+/**
+ * 与HAL相同，发送期间不复制数据，调用方需保证数据在发送完成回调前有效
+ */
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size) {
+    UARTState &uart = Sim().uart[huart->Instance->Index];
+    if (uart.txBusy) {
+        return HAL_BUSY;
+    }
+    if (pData == nullptr || Size == 0) {
+        return HAL_ERROR;
+    }
+    uart.txData = pData;
+    uart.txSize = Size;
+    uart.txCredit = 0;
+    uart.txBusy = true;
+    uart.txDMA = false;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size) {
+    HAL_StatusTypeDef status = HAL_UART_Transmit_IT(huart, pData, Size);
+    if (status == HAL_OK) {
+        Sim().uart[huart->Instance->Index].txDMA = true;
+    }
+    return status;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size) {
+    if (huart->hdmarx == nullptr || huart->hdmarx->Init.Mode != DMA_CIRCULAR) {
+        return HAL_UARTEx_ReceiveToIdle_IT(huart, pData, Size);
+    }
+    UARTState &uart = Sim().uart[huart->Instance->Index];
+    if (pData == nullptr || Size == 0) {
+        return HAL_ERROR;
+    }
+    uart.rxData = pData;
+    uart.rxSize = Size;
+    uart.rxPos = 0;
+    uart.rxCircular = true;
+    huart->RxXferSize = Size;
+    huart->hdmarx->Instance->NDTR = Size;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size) {
+    UARTState &uart = Sim().uart[huart->Instance->Index];
+    if (uart.rxArmed) {
+        return HAL_BUSY;
+    }
+    if (pData == nullptr || Size == 0) {
+        return HAL_ERROR;
+    }
+    uart.rxData = pData;
+    uart.rxSize = Size;
+    uart.rxArmed = true;
+    huart->RxXferSize = Size;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart) {
+    Sim().uart[huart->Instance->Index].rxArmed = false;
+    return HAL_OK;
+}
+
+HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart) {
+    return huart->RxEventType;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma) {
+    return hdma != nullptr && hdma->Instance != nullptr ? HAL_OK : HAL_ERROR;
+}
+
+/**
+ * 软件复位清除BUSY标志，但从机仍拉低SDA时外设重新使能后立即再次检测到总线忙；引脚恢复为复用功能
+ */
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c) {
+    uint8_t bus = static_cast<uint8_t>(hi2c->Instance->Index);
+    I2CState &i2c = Sim().i2c[bus];
+    i2c.gpio = false;
+    hi2c->Instance->SR2 = i2c.stalled ? I2C_SR2_BUSY : 0;
+    UpdateI2CLines(bus);
+    return HAL_OK;
+}
+
+/**
+ * 中止进行中的传输，从机拉住的总线不受影响
+ */
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c) {
+    I2CState &i2c = Sim().i2c[hi2c->Instance->Index];
+    i2c.busy = false;
+    i2c.credit = 0;
+    hi2c->Instance->SR2 = i2c.stalled ? I2C_SR2_BUSY : 0;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size) {
+    return StartI2C(hi2c, I2CDone_e::MasterTx, DevAddress, false, 0, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                              uint16_t Size) {
+    return StartI2C(hi2c, I2CDone_e::MasterTx, DevAddress, false, 0, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                            uint16_t Size) {
+    return StartI2C(hi2c, I2CDone_e::MasterRx, DevAddress, false, 0, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size) {
+    return StartI2C(hi2c, I2CDone_e::MasterRx, DevAddress, false, 0, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+    return StartI2C(hi2c, I2CDone_e::MemTx, DevAddress, true, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+    return StartI2C(hi2c, I2CDone_e::MemTx, DevAddress, true, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                      uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+    return StartI2C(hi2c, I2CDone_e::MemRx, DevAddress, true, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+    return StartI2C(hi2c, I2CDone_e::MemRx, DevAddress, true, MemAddress, pData, Size);
+}
+
+uint32_t HAL_I2C_GetError(const I2C_HandleTypeDef *hi2c) {
+    return hi2c->ErrorCode;
+}
+
+__weak void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+
+__weak void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+
+__weak void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+
+__weak void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+
+__weak void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
+                                             uint16_t Size) {
+    return StartSPI(hspi, SPIDone_e::TxRx, pTxData, pRxData, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
+                                              uint16_t Size) {
+    return StartSPI(hspi, SPIDone_e::TxRx, pTxData, pRxData, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_IT(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size) {
+    return StartSPI(hspi, SPIDone_e::Tx, pData, nullptr, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size) {
+    return StartSPI(hspi, SPIDone_e::Tx, pData, nullptr, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size) {
+    return StartSPI(hspi, SPIDone_e::Rx, nullptr, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size) {
+    return StartSPI(hspi, SPIDone_e::Rx, nullptr, pData, Size);
+}
+
+uint32_t HAL_SPI_GetError(const SPI_HandleTypeDef *hspi) {
+    return hspi->ErrorCode;
+}
+
+__weak void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi) {}
+
+__weak void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {}
+
+__weak void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi) {}
+
+__weak void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {}
+
+__weak void BSP_UART_IRQHook(UART_HandleTypeDef *huart) {}
+
+__weak void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {}
+
+__weak void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {}
+
+__weak void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {}
+
+__weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size) {}
+
+#ifdef __cplusplus
+}
+#endif
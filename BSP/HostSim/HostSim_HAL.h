@@ -0,0 +1,492 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_HOSTSIM_HAL_H
+#define FINEMOTE_HOSTSIM_HAL_H
+
+/**
+ * 主机仿真用的STM32 HAL子集，只提供框架与FineMote_BSP实际用到的类型、宏与函数，
+ * 名称与取值与STM32F4 HAL保持一致，外设行为由HostSim_HAL.cpp中的虚拟总线实现
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#define __IO volatile
+
+#ifndef __weak
+#define __weak __attribute__((weak))
+#endif
+
+#ifndef __packed
+#define __packed __attribute__((__packed__))
+#endif
+
+typedef enum {
+    HAL_OK = 0x00U,
+    HAL_ERROR = 0x01U,
+    HAL_BUSY = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum {
+    DISABLE = 0U,
+    ENABLE = !DISABLE
+} FunctionalState;
+
+/**
+ * GPIO
+ */
+typedef struct {
+    __IO uint32_t IDR;  // 输入电平，由仿真程序设置
+    __IO uint32_t ODR;  // 输出电平
+} GPIO_TypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+#define GPIO_PIN_0  ((uint16_t)0x0001)
+#define GPIO_PIN_1  ((uint16_t)0x0002)
+#define GPIO_PIN_2  ((uint16_t)0x0004)
+#define GPIO_PIN_3  ((uint16_t)0x0008)
+#define GPIO_PIN_4  ((uint16_t)0x0010)
+#define GPIO_PIN_5  ((uint16_t)0x0020)
+#define GPIO_PIN_6  ((uint16_t)0x0040)
+#define GPIO_PIN_7  ((uint16_t)0x0080)
+#define GPIO_PIN_8  ((uint16_t)0x0100)
+#define GPIO_PIN_9  ((uint16_t)0x0200)
+#define GPIO_PIN_10 ((uint16_t)0x0400)
+#define GPIO_PIN_11 ((uint16_t)0x0800)
+#define GPIO_PIN_12 ((uint16_t)0x1000)
+#define GPIO_PIN_13 ((uint16_t)0x2000)
+#define GPIO_PIN_14 ((uint16_t)0x4000)
+#define GPIO_PIN_15 ((uint16_t)0x8000)
+
+extern GPIO_TypeDef HostSim_GPIO[9];
+#define GPIOA (&HostSim_GPIO[0])
+#define GPIOB (&HostSim_GPIO[1])
+#define GPIOC (&HostSim_GPIO[2])
+#define GPIOD (&HostSim_GPIO[3])
+#define GPIOE (&HostSim_GPIO[4])
+#define GPIOF (&HostSim_GPIO[5])
+#define GPIOG (&HostSim_GPIO[6])
+#define GPIOH (&HostSim_GPIO[7])
+#define GPIOI (&HostSim_GPIO[8])
+
+#define GPIO_MODE_INPUT     0x00000000U
+#define GPIO_MODE_OUTPUT_PP 0x00000001U
+#define GPIO_MODE_OUTPUT_OD 0x00000011U
+#define GPIO_MODE_AF_OD     0x00000012U
+
+#define GPIO_NOPULL 0x00000000U
+#define GPIO_PULLUP 0x00000001U
+
+#define GPIO_SPEED_FREQ_LOW       0x00000000U
+#define GPIO_SPEED_FREQ_VERY_HIGH 0x00000003U
+
+typedef struct {
+    uint32_t Pin;
+    uint32_t Mode;
+    uint32_t Pull;
+    uint32_t Speed;
+    uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+/**
+ * TIM
+ */
+typedef struct {
+    __IO uint32_t CNT;
+    __IO uint32_t PSC;
+    __IO uint32_t ARR;
+    __IO uint32_t CCR1;
+    __IO uint32_t CCR2;
+    __IO uint32_t CCR3;
+    __IO uint32_t CCR4;
+} TIM_TypeDef;
+
+typedef struct {
+    TIM_TypeDef *Instance;
+} TIM_HandleTypeDef;
+
+extern TIM_TypeDef HostSim_TIM[15];
+#define TIM1  (&HostSim_TIM[1])
+#define TIM2  (&HostSim_TIM[2])
+#define TIM3  (&HostSim_TIM[3])
+#define TIM4  (&HostSim_TIM[4])
+#define TIM5  (&HostSim_TIM[5])
+#define TIM6  (&HostSim_TIM[6])
+#define TIM7  (&HostSim_TIM[7])
+#define TIM8  (&HostSim_TIM[8])
+#define TIM9  (&HostSim_TIM[9])
+#define TIM10 (&HostSim_TIM[10])
+#define TIM11 (&HostSim_TIM[11])
+#define TIM12 (&HostSim_TIM[12])
+
+#define TIM_CHANNEL_1 0x00000000U
+#define TIM_CHANNEL_2 0x00000004U
+#define TIM_CHANNEL_3 0x00000008U
+#define TIM_CHANNEL_4 0x0000000CU
+
+#define __HAL_TIM_GET_AUTORELOAD(__HANDLE__) ((__HANDLE__)->Instance->ARR)
+#define __HAL_TIM_SET_AUTORELOAD(__HANDLE__, __AUTORELOAD__) ((__HANDLE__)->Instance->ARR = (__AUTORELOAD__))
+#define __HAL_TIM_GET_COMPARE(__HANDLE__, __CHANNEL__) (*(&((__HANDLE__)->Instance->CCR1) + ((__CHANNEL__) >> 2U)))
+#define __HAL_TIM_SET_COMPARE(__HANDLE__, __CHANNEL__, __COMPARE__) \
+    (*(&((__HANDLE__)->Instance->CCR1) + ((__CHANNEL__) >> 2U)) = (__COMPARE__))
+#define __HAL_TIM_SetCompare __HAL_TIM_SET_COMPARE
+
+/**
+ * IWDG
+ */
+typedef struct {
+    uint32_t RefreshCount;
+} IWDG_HandleTypeDef;
+
+/**
+ * CAN
+ */
+typedef struct {
+    uint32_t Index;
+    uint32_t MCR;
+} CAN_TypeDef;
+
+typedef struct {
+    CAN_TypeDef *Instance;
+    __IO uint32_t ErrorCode;
+} CAN_HandleTypeDef;
+
+typedef struct {
+    uint32_t StdId;
+    uint32_t ExtId;
+    uint32_t IDE;
+    uint32_t RTR;
+    uint32_t DLC;
+    FunctionalState TransmitGlobalTime;
+} CAN_TxHeaderTypeDef;
+
+typedef struct {
+    uint32_t StdId;
+    uint32_t ExtId;
+    uint32_t IDE;
+    uint32_t RTR;
+    uint32_t DLC;
+    uint32_t Timestamp;
+    uint32_t FilterMatchIndex;
+} CAN_RxHeaderTypeDef;
+
+typedef struct {
+    uint32_t FilterIdHigh;
+    uint32_t FilterIdLow;
+    uint32_t FilterMaskIdHigh;
+    uint32_t FilterMaskIdLow;
+    uint32_t FilterFIFOAssignment;
+    uint32_t FilterBank;
+    uint32_t FilterMode;
+    uint32_t FilterScale;
+    uint32_t FilterActivation;
+    uint32_t SlaveStartFilterBank;
+} CAN_FilterTypeDef;
+
+extern CAN_TypeDef HostSim_CAN[3];
+#define CAN1 (&HostSim_CAN[1])
+#define CAN2 (&HostSim_CAN[2])
+
+#define CAN_MCR_TXFP            0x00000004U
+#define CAN_ID_STD              0x00000000U
+#define CAN_ID_EXT              0x00000004U
+#define CAN_RTR_DATA            0x00000000U
+#define CAN_RTR_REMOTE          0x00000002U
+
+#define CAN_FILTERMODE_IDMASK   0x00000000U
+#define CAN_FILTERMODE_IDLIST   0x00000001U
+#define CAN_FILTERSCALE_16BIT   0x00000000U
+#define CAN_FILTERSCALE_32BIT   0x00000001U
+#define CAN_FILTER_FIFO0        0x00000000U
+#define CAN_FILTER_FIFO1        0x00000001U
+#define CAN_RX_FIFO0            0x00000000U
+#define CAN_RX_FIFO1            0x00000001U
+
+#define CAN_TX_MAILBOX0         0x00000001U
+#define CAN_TX_MAILBOX1         0x00000002U
+#define CAN_TX_MAILBOX2         0x00000004U
+
+#define CAN_IT_TX_MAILBOX_EMPTY     0x00000001U
+#define CAN_IT_RX_FIFO0_MSG_PENDING 0x00000002U
+#define CAN_IT_RX_FIFO0_FULL        0x00000004U
+#define CAN_IT_RX_FIFO0_OVERRUN     0x00000008U
+#define CAN_IT_RX_FIFO1_MSG_PENDING 0x00000010U
+#define CAN_IT_RX_FIFO1_FULL        0x00000020U
+#define CAN_IT_RX_FIFO1_OVERRUN     0x00000040U
+
+#define HAL_CAN_ERROR_NONE      0x00000000U
+#define HAL_CAN_ERROR_PARAM     0x00200000U
+#define HAL_CAN_ERROR_RX_FOV0   0x00000200U
+#define HAL_CAN_ERROR_RX_FOV1   0x00000400U
+
+/**
+ * DMA，只模拟UART收发所需的计数器与模式
+ */
+typedef struct {
+    __IO uint32_t NDTR;
+} DMA_Stream_TypeDef;
+
+typedef struct {
+    uint32_t Mode;
+} DMA_InitTypeDef;
+
+typedef struct {
+    DMA_Stream_TypeDef *Instance;
+    DMA_InitTypeDef Init;
+} DMA_HandleTypeDef;
+
+#define DMA_NORMAL   0x00000000U
+#define DMA_CIRCULAR 0x00000100U
+
+#define __HAL_DMA_GET_COUNTER(__HANDLE__) ((__HANDLE__)->Instance->NDTR)
+
+/**
+ * UART
+ */
+typedef struct {
+    uint32_t Index;
+    __IO uint32_t SR;
+} USART_TypeDef;
+
+#define UART_FLAG_IDLE 0x00000010U
+
+#define __HAL_UART_GET_FLAG(__HANDLE__, __FLAG__) (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+
+typedef struct {
+    uint32_t BaudRate;
+} UART_InitTypeDef;
+
+typedef uint32_t HAL_UART_RxEventTypeTypeDef;
+
+#define HAL_UART_RXEVENT_TC   0x00000000U
+#define HAL_UART_RXEVENT_HT   0x00000001U
+#define HAL_UART_RXEVENT_IDLE 0x00000002U
+
+typedef struct {
+    USART_TypeDef *Instance;
+    UART_InitTypeDef Init;
+    uint16_t RxXferSize;
+    __IO HAL_UART_RxEventTypeTypeDef RxEventType;
+    DMA_HandleTypeDef *hdmatx;
+    DMA_HandleTypeDef *hdmarx;
+} UART_HandleTypeDef;
+
+extern USART_TypeDef HostSim_USART[9];
+#define USART1 (&HostSim_USART[1])
+#define USART2 (&HostSim_USART[2])
+#define USART3 (&HostSim_USART[3])
+#define UART4  (&HostSim_USART[4])
+#define UART5  (&HostSim_USART[5])
+#define USART6 (&HostSim_USART[6])
+#define UART7  (&HostSim_USART[7])
+#define UART8  (&HostSim_USART[8])
+
+/**
+ * I2C，只模拟SR2中的BUSY标志
+ */
+typedef struct {
+    uint32_t Index;
+    __IO uint32_t SR2;
+} I2C_TypeDef;
+
+#define I2C_SR2_BUSY  0x00000002U
+#define I2C_FLAG_BUSY 0x00100002U
+
+#define __HAL_I2C_GET_FLAG(__HANDLE__, __FLAG__) \
+    ((((__HANDLE__)->Instance->SR2) & ((__FLAG__) & 0xFFFFU)) == ((__FLAG__) & 0xFFFFU))
+
+#define I2C_MEMADD_SIZE_8BIT 0x00000001U
+
+#define HAL_I2C_ERROR_NONE 0x00000000U
+#define HAL_I2C_ERROR_AF   0x00000004U
+
+typedef struct {
+    uint32_t ClockSpeed;
+} I2C_InitTypeDef;
+
+typedef struct {
+    I2C_TypeDef *Instance;
+    I2C_InitTypeDef Init;
+    DMA_HandleTypeDef *hdmatx;
+    DMA_HandleTypeDef *hdmarx;
+    __IO uint32_t ErrorCode;
+} I2C_HandleTypeDef;
+
+extern I2C_TypeDef HostSim_I2C[4];
+#define I2C1 (&HostSim_I2C[1])
+#define I2C2 (&HostSim_I2C[2])
+#define I2C3 (&HostSim_I2C[3])
+
+/**
+ * SPI，只模拟CR1中的使能、时钟分频与模式位
+ */
+typedef struct {
+    uint32_t Index;
+    __IO uint32_t CR1;
+} SPI_TypeDef;
+
+#define SPI_CR1_CPHA 0x00000001U
+#define SPI_CR1_CPOL 0x00000002U
+#define SPI_CR1_BR   0x00000038U
+#define SPI_CR1_SPE  0x00000040U
+
+#define SPI_POLARITY_LOW  0x00000000U
+#define SPI_POLARITY_HIGH SPI_CR1_CPOL
+#define SPI_PHASE_1EDGE   0x00000000U
+#define SPI_PHASE_2EDGE   SPI_CR1_CPHA
+
+#define SPI_BAUDRATEPRESCALER_2   0x00000000U
+#define SPI_BAUDRATEPRESCALER_4   0x00000008U
+#define SPI_BAUDRATEPRESCALER_8   0x00000010U
+#define SPI_BAUDRATEPRESCALER_16  0x00000018U
+#define SPI_BAUDRATEPRESCALER_32  0x00000020U
+#define SPI_BAUDRATEPRESCALER_64  0x00000028U
+#define SPI_BAUDRATEPRESCALER_128 0x00000030U
+#define SPI_BAUDRATEPRESCALER_256 0x00000038U
+
+#define HAL_SPI_ERROR_NONE 0x00000000U
+#define HAL_SPI_ERROR_OVR  0x00000004U
+
+#define MODIFY_REG(REG, CLEARMASK, SETMASK) ((REG) = (((REG) & (~(CLEARMASK))) | (SETMASK)))
+#define __HAL_SPI_DISABLE(__HANDLE__) ((__HANDLE__)->Instance->CR1 &= ~SPI_CR1_SPE)
+
+typedef struct {
+    uint32_t CLKPolarity;
+    uint32_t CLKPhase;
+    uint32_t BaudRatePrescaler;
+} SPI_InitTypeDef;
+
+typedef struct {
+    SPI_TypeDef *Instance;
+    SPI_InitTypeDef Init;
+    DMA_HandleTypeDef *hdmatx;
+    DMA_HandleTypeDef *hdmarx;
+    __IO uint32_t ErrorCode;
+} SPI_HandleTypeDef;
+
+extern SPI_TypeDef HostSim_SPI[4];
+#define SPI1 (&HostSim_SPI[1])
+#define SPI2 (&HostSim_SPI[2])
+#define SPI3 (&HostSim_SPI[3])
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t HAL_GetTick();
+void HAL_IncTick();
+void HAL_Delay(uint32_t Delay);
+
+/**
+ * 仿真的PRIMASK只记录屏蔽状态，中断回调均在仿真线程内同步调用，无需真正屏蔽；HAL启动函数据此统计关中断期间的调用
+ */
+uint32_t __get_PRIMASK();
+void __set_PRIMASK(uint32_t priMask);
+void __disable_irq();
+
+/**
+ * 引脚模式不影响仿真，输出电平始终写入ODR，输入电平由仿真程序或虚拟总线设置IDR
+ */
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t Channel);
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
+
+HAL_StatusTypeDef HAL_IWDG_Refresh(IWDG_HandleTypeDef *hiwdg);
+
+HAL_StatusTypeDef HAL_CAN_ConfigFilter(CAN_HandleTypeDef *hcan, const CAN_FilterTypeDef *sFilterConfig);
+HAL_StatusTypeDef HAL_CAN_Start(CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_ActivateNotification(CAN_HandleTypeDef *hcan, uint32_t ActiveITs);
+HAL_StatusTypeDef HAL_CAN_DeactivateNotification(CAN_HandleTypeDef *hcan, uint32_t InactiveITs);
+HAL_StatusTypeDef HAL_CAN_AddTxMessage(CAN_HandleTypeDef *hcan, const CAN_TxHeaderTypeDef *pHeader,
+                                       const uint8_t aData[], uint32_t *pTxMailbox);
+uint32_t HAL_CAN_GetTxMailboxesFreeLevel(const CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_GetRxMessage(CAN_HandleTypeDef *hcan, uint32_t RxFifo, CAN_RxHeaderTypeDef *pHeader,
+                                       uint8_t aData[]);
+uint32_t HAL_CAN_GetRxFifoFillLevel(const CAN_HandleTypeDef *hcan, uint32_t RxFifo);
+uint32_t HAL_CAN_GetError(const CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_ResetError(CAN_HandleTypeDef *hcan);
+void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan);
+void HAL_CAN_RxFifo1MsgPendingCallback(CAN_HandleTypeDef *hcan);
+void HAL_CAN_TxMailbox0CompleteCallback(CAN_HandleTypeDef *hcan);
+void HAL_CAN_TxMailbox1CompleteCallback(CAN_HandleTypeDef *hcan);
+void HAL_CAN_TxMailbox2CompleteCallback(CAN_HandleTypeDef *hcan);
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan);
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart);
+HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                              uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                            uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                      uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+uint32_t HAL_I2C_GetError(const I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
+                                             uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
+                                              uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Transmit_IT(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Receive_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+uint32_t HAL_SPI_GetError(const SPI_HandleTypeDef *hspi);
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+
+/**
+ * 目标板在stm32f4xx_it.c的串口及DMA中断入口调用，仿真中按目标板的中断次数调用
+ */
+void BSP_UART_IRQHook(UART_HandleTypeDef *huart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
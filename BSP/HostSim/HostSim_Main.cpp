@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "HostSim.h"
+#include "HostSim_Bus.h"
+#include "DeviceBase.h"
+#include "Scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BSP_Setup();
+void Setup();
+void Loop();
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * 主机仿真入口
+ * @param argv[1] 仿真时长(ms)，省略时按实时速度持续运行，指定时全速运行并在结束后输出各周期执行统计
+ */
+int main(int argc, char *argv[]) {
+    uint32_t duration = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 0;
+    HostSim::SetDuration(duration);
+    HostSim::SetRealTime(duration == 0);
+
+    PeripheralsInit::GetInstance();
+    BSP_Setup();
+    Setup();
+
+    while (HostSim::IsRunning()) {
+        Loop();
+    }
+
+    printf("simulated: %u ms, control loop: %.3f us/tick\n", HAL_GetTick(),
+           HAL_GetTick() > 0 ? static_cast<double>(HostSim::GetControlTime()) / 1000.0 / HAL_GetTick() : 0.0);
+    printf("devices: %zu, peak load: %u, average load: %.3f\n", DeviceBase::GetDeviceCount(),
+           DeviceBase::GetTickLoad().peak, DeviceBase::GetTickLoad().average);
+    if (GetTaskOverflow() > 0) {
+        printf("tasks: %zu not scheduled, increase SCHEDULER_TASK_SLOTS\n", GetTaskOverflow());
+    }
+    for (size_t i = 0; i < GetTaskCount(); ++i) {
+        const TaskStats_t *stats = GetTaskStats(i);
+        printf("task %s: run %u, defer %u, miss %u, overrun %u, max %u us\n", GetTaskDescriptor(i)->name,
+               stats->runCount, stats->deferCount, stats->missCount, stats->overrunCount, stats->maxUs);
+    }
+    for (uint8_t bus = 1; bus <= CAN_BUS_MAXIMUM_COUNT; ++bus) {
+        const HostSim_CANStats_t &stats = HostSim::CAN_GetStats(bus);
+        printf("CAN%u: tx %u, rx %u, filtered %u, overrun %u\n", bus, stats.txFrames, stats.rxFrames,
+               stats.rxFiltered, stats.rxOverrun);
+    }
+    return 0;
+}
@@ -9,9 +9,17 @@
 
 #include "Board.h"
 
+/**
+ * RS485收发方向控制
+ * @note 在请求提交前置为发送、在发送完成(TC)中断中置为接收，转换不受控制周期的量化
+ */
 template <size_t ID>
 class RS485FlowControl {
 public:
+    static void Init() {
+        Switch2Rx();
+    }
+
     static void Switch2Rx() {
         HAL_GPIO_WritePin(BSP_RS485FlowCtrlPortList[ID], BSP_RS485FlowCtrlPinList[ID], GPIO_PIN_RESET);
     }
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_BSP_SPI_H
+#define FINEMOTE_BSP_SPI_H
+
+#include "Board.h"
+
+/**
+ * SPI从机的时钟配置，取值为HAL的SPI_BAUDRATEPRESCALER_x、SPI_POLARITY_x与SPI_PHASE_x
+ */
+typedef struct {
+    uint32_t prescaler;
+    uint32_t polarity;
+    uint32_t phase;
+} SPI_Config_t;
+
+inline bool operator==(const SPI_Config_t &a, const SPI_Config_t &b) {
+    return a.prescaler == b.prescaler && a.polarity == b.polarity && a.phase == b.phase;
+}
+
+inline bool operator!=(const SPI_Config_t &a, const SPI_Config_t &b) {
+    return !(a == b);
+}
+
+/**
+ * SPI主机的非阻塞全双工传输，收发DMA流均已配置时使用DMA，否则使用中断（需在CubeMX中开启SPI中断）
+ * @note 每次传输结束时由HAL回调FineMoteAux_SPI分发到对应总线
+ */
+template<uint8_t ID>
+class BSP_SPI {
+public:
+    static BSP_SPI &GetInstance() {
+        static BSP_SPI instance;
+        return instance;
+    }
+
+    /**
+     * @return 外设忙或参数非法时返回false，此时不会产生回调
+     */
+    bool TransmitReceive(const uint8_t *txData, uint8_t *rxData, uint16_t size) {
+        SPI_HandleTypeDef *hspi = BSP_SPIList[ID];
+        if (UseDMA(hspi)) {
+            return HAL_SPI_TransmitReceive_DMA(hspi, txData, rxData, size) == HAL_OK;
+        }
+        return HAL_SPI_TransmitReceive_IT(hspi, txData, rxData, size) == HAL_OK;
+    }
+
+    bool Transmit(const uint8_t *data, uint16_t size) {
+        SPI_HandleTypeDef *hspi = BSP_SPIList[ID];
+        if (UseDMA(hspi)) {
+            return HAL_SPI_Transmit_DMA(hspi, data, size) == HAL_OK;
+        }
+        return HAL_SPI_Transmit_IT(hspi, data, size) == HAL_OK;
+    }
+
+    /**
+     * 全双工主机接收时发出的是data中原有的内容
+     */
+    bool Receive(uint8_t *data, uint16_t size) {
+        SPI_HandleTypeDef *hspi = BSP_SPIList[ID];
+        if (UseDMA(hspi)) {
+            return HAL_SPI_Receive_DMA(hspi, data, size) == HAL_OK;
+        }
+        return HAL_SPI_Receive_IT(hspi, data, size) == HAL_OK;
+    }
+
+    /**
+     * 切换时钟分频与模式，只改写CR1中的对应位；需在总线空闲且片选均未选中时调用
+     */
+    void Configure(const SPI_Config_t &config) {
+        SPI_HandleTypeDef *hspi = BSP_SPIList[ID];
+        __HAL_SPI_DISABLE(hspi);
+        MODIFY_REG(hspi->Instance->CR1, SPI_CR1_BR | SPI_CR1_CPOL | SPI_CR1_CPHA,
+                   config.prescaler | config.polarity | config.phase);
+        hspi->Init.BaudRatePrescaler = config.prescaler;
+        hspi->Init.CLKPolarity = config.polarity;
+        hspi->Init.CLKPhase = config.phase;
+    }
+
+    /**
+     * @return 当前生效的配置，初始为CubeMX中的配置
+     */
+    SPI_Config_t GetConfig() {
+        SPI_HandleTypeDef *hspi = BSP_SPIList[ID];
+        return {hspi->Init.BaudRatePrescaler, hspi->Init.CLKPolarity, hspi->Init.CLKPhase};
+    }
+
+    uint32_t GetError() {
+        return HAL_SPI_GetError(BSP_SPIList[ID]);
+    }
+
+private:
+    BSP_SPI() {
+        static_assert(ID > 0 && ID <= SPI_BUS_MAXIMUM_COUNT && BSP_SPIList[ID] != nullptr, "Invalid SPI ID");
+        PeripheralsInit::GetInstance();
+    }
+
+    static bool UseDMA(SPI_HandleTypeDef *hspi) {
+        return hspi->hdmatx != nullptr && hspi->hdmarx != nullptr;
+    }
+};
+
+#endif
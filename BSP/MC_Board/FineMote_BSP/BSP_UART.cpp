@@ -34,7 +34,7 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
         MicroROSTransport_RxEventCallback(0);
     } else {
         // 其他 UART 的错误处理
-        FineMoteAux_UART<>::OnRxComplete(huart, 0);
+        FineMoteAux_UART<>::OnError(huart);
     }
 }
 
@@ -48,6 +48,11 @@ void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t size) {
     }
 }
 
+// 在stm32f4xx_it.c中串口及其DMA流的中断入口调用，统计中断次数
+void BSP_UART_IRQHook(UART_HandleTypeDef *huart) {
+    FineMoteAux_UART<>::OnIRQ(huart);
+}
+
 #ifdef __cplusplus
 }
 #endif
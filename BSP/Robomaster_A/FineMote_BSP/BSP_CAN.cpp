@@ -12,7 +12,15 @@ extern "C" {
 #endif
 
 void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan) {
-    FineMoteAux_CAN<>::OnRxComplete(hcan);
+    FineMoteAux_CAN<>::OnRxComplete(hcan, CAN_RX_FIFO0);
+}
+
+void HAL_CAN_RxFifo1MsgPendingCallback(CAN_HandleTypeDef *hcan) {
+    FineMoteAux_CAN<>::OnRxComplete(hcan, CAN_RX_FIFO1);
+}
+
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan) {
+    FineMoteAux_CAN<>::OnError(hcan);
 }
 
 void HAL_CAN_TxMailbox0CompleteCallback(CAN_HandleTypeDef *hcan) {
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_BSP_I2C_H
+#define FINEMOTE_BSP_I2C_H
+
+#include "Board.h"
+#include "Profiler/CycleCounter.hpp"
+
+#define BSP_I2C_DMA_MIN_SIZE 2  // 不足该长度的传输使用中断，单字节DMA接收的收益低于其配置开销
+
+/**
+ * I2C主机的非阻塞传输，地址为7位地址，不含读写位
+ * @note 每次传输结束时由HAL回调FineMoteAux_I2C分发到对应总线
+ */
+template<uint8_t ID>
+class BSP_I2C {
+public:
+    static BSP_I2C &GetInstance() {
+        static BSP_I2C instance;
+        return instance;
+    }
+
+    /**
+     * @return 外设忙或参数非法时返回false，此时不会产生回调
+     */
+    bool Transmit(uint8_t addr, uint8_t *data, uint16_t size) {
+        I2C_HandleTypeDef *hi2c = BSP_I2CList[ID];
+        if (UseDMA(hi2c->hdmatx, size)) {
+            return HAL_I2C_Master_Transmit_DMA(hi2c, addr << 1, data, size) == HAL_OK;
+        }
+        return HAL_I2C_Master_Transmit_IT(hi2c, addr << 1, data, size) == HAL_OK;
+    }
+
+    bool Receive(uint8_t addr, uint8_t *data, uint16_t size) {
+        I2C_HandleTypeDef *hi2c = BSP_I2CList[ID];
+        if (UseDMA(hi2c->hdmarx, size)) {
+            return HAL_I2C_Master_Receive_DMA(hi2c, addr << 1, data, size) == HAL_OK;
+        }
+        return HAL_I2C_Master_Receive_IT(hi2c, addr << 1, data, size) == HAL_OK;
+    }
+
+    bool MemWrite(uint8_t addr, uint8_t reg, uint8_t *data, uint16_t size) {
+        I2C_HandleTypeDef *hi2c = BSP_I2CList[ID];
+        if (UseDMA(hi2c->hdmatx, size)) {
+            return HAL_I2C_Mem_Write_DMA(hi2c, addr << 1, reg, I2C_MEMADD_SIZE_8BIT, data, size) == HAL_OK;
+        }
+        return HAL_I2C_Mem_Write_IT(hi2c, addr << 1, reg, I2C_MEMADD_SIZE_8BIT, data, size) == HAL_OK;
+    }
+
+    bool MemRead(uint8_t addr, uint8_t reg, uint8_t *data, uint16_t size) {
+        I2C_HandleTypeDef *hi2c = BSP_I2CList[ID];
+        if (UseDMA(hi2c->hdmarx, size)) {
+            return HAL_I2C_Mem_Read_DMA(hi2c, addr << 1, reg, I2C_MEMADD_SIZE_8BIT, data, size) == HAL_OK;
+        }
+        return HAL_I2C_Mem_Read_IT(hi2c, addr << 1, reg, I2C_MEMADD_SIZE_8BIT, data, size) == HAL_OK;
+    }
+
+    /**
+     * 总线被占用（SDA或SCL被拉低）时HAL启动传输前会忙等至多25ms，启动前先检查以便直接恢复总线
+     */
+    bool IsBusBusy() {
+        return __HAL_I2C_GET_FLAG(BSP_I2CList[ID], I2C_FLAG_BUSY);
+    }
+
+    /**
+     * 上一次传输发出STOP后BUSY标志需经过数微秒才清除，等待至多两个SCL周期
+     * @return 总线是否已空闲
+     */
+    bool WaitBusIdle() {
+        uint32_t start = CycleCounter<>::Now();
+        uint32_t window = 2 * HalfPeriod();
+        while (IsBusBusy()) {
+            if (CycleCounter<>::Now() - start >= window) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t GetClockSpeed() {
+        return BSP_I2CList[ID]->Init.ClockSpeed;
+    }
+
+    /**
+     * 读取HAL记录的错误，如HAL_I2C_ERROR_AF（从机无应答）
+     */
+    uint32_t GetError() {
+        return HAL_I2C_GetError(BSP_I2CList[ID]);
+    }
+
+    /**
+     * 中止当前传输，在SCL上补发时钟并产生STOP，再重新初始化外设
+     * @note 从机在读传输中途被打断时持续拉低SDA，只复位外设无法释放总线；补发至多9个时钟使其送完当前字节后释放SDA，
+     *       HAL_I2C_Init中的软件复位随后清除残留的BUSY状态
+     * @note 耗时约10个SCL周期，不可在临界区中调用；SCL被从机持续拉低时无法恢复，调用者应再次检查IsBusBusy()
+     */
+    void Recover() {
+        HAL_I2C_DeInit(BSP_I2CList[ID]);
+        ClockOut();
+        HAL_I2C_Init(BSP_I2CList[ID]);
+    }
+
+private:
+    BSP_I2C() {
+        static_assert(ID > 0 && ID <= I2C_BUS_MAXIMUM_COUNT && BSP_I2CList[ID] != nullptr, "Invalid I2C ID");
+        PeripheralsInit::GetInstance();
+        CycleCounter<>::Init();
+    }
+
+    /**
+     * 以开漏输出驱动SCL，SDA为高时停止，最后在SCL为高时释放SDA产生STOP；引脚由HAL_I2C_Init中的MspInit恢复为复用功能
+     */
+    void ClockOut() {
+        GPIO_TypeDef *sclPort = BSP_I2CSCLPortList[ID];
+        GPIO_TypeDef *sdaPort = BSP_I2CSDAPortList[ID];
+        const uint16_t sclPin = BSP_I2CSCLPinList[ID];
+        const uint16_t sdaPin = BSP_I2CSDAPinList[ID];
+
+        HAL_GPIO_WritePin(sclPort, sclPin, GPIO_PIN_SET);
+        HAL_GPIO_WritePin(sdaPort, sdaPin, GPIO_PIN_SET);
+        GPIO_InitTypeDef gpio = {};
+        gpio.Mode = GPIO_MODE_OUTPUT_OD;
+        gpio.Pull = GPIO_NOPULL;
+        gpio.Speed = GPIO_SPEED_FREQ_LOW;
+        gpio.Pin = sclPin;
+        HAL_GPIO_Init(sclPort, &gpio);
+        gpio.Pin = sdaPin;
+        HAL_GPIO_Init(sdaPort, &gpio);
+
+        uint32_t halfPeriod = HalfPeriod();
+        for (size_t i = 0; i < 9 && HAL_GPIO_ReadPin(sdaPort, sdaPin) == GPIO_PIN_RESET; ++i) {
+            HAL_GPIO_WritePin(sclPort, sclPin, GPIO_PIN_RESET);
+            Wait(halfPeriod);
+            HAL_GPIO_WritePin(sclPort, sclPin, GPIO_PIN_SET);
+            Wait(halfPeriod);
+        }
+
+        HAL_GPIO_WritePin(sclPort, sclPin, GPIO_PIN_RESET);
+        Wait(halfPeriod);
+        HAL_GPIO_WritePin(sdaPort, sdaPin, GPIO_PIN_RESET);
+        Wait(halfPeriod);
+        HAL_GPIO_WritePin(sclPort, sclPin, GPIO_PIN_SET);
+        Wait(halfPeriod);
+        HAL_GPIO_WritePin(sdaPort, sdaPin, GPIO_PIN_SET);
+        Wait(halfPeriod);
+    }
+
+    uint32_t HalfPeriod() {
+        return CycleCounter<>::FromMicros((500000 + GetClockSpeed() - 1) / GetClockSpeed());
+    }
+
+    static void Wait(uint32_t cycles) {
+        uint32_t start = CycleCounter<>::Now();
+        while (CycleCounter<>::Now() - start < cycles) {
+        }
+    }
+
+    static bool UseDMA(DMA_HandleTypeDef *hdma, uint16_t size) {
+        return hdma != nullptr && size >= BSP_I2C_DMA_MIN_SIZE;
+    }
+};
+
+#endif
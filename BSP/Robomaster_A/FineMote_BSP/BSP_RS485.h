@@ -13,6 +13,8 @@ template <size_t ID>
 class RS485FlowControl {
 public:
     // 自动流控
+    static void Init() {}
+
     static void Switch2Rx() {}
 
     static void Switch2Tx() {}
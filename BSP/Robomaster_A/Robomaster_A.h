@@ -43,6 +43,9 @@ public:
  */
 constexpr UART_HandleTypeDef *BSP_UARTList[] = {nullptr, &huart1, &huart2, &huart3, nullptr, nullptr, &huart6, &huart7, &huart8};
 constexpr size_t UART_BUS_MAXIMUM_COUNT = sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) - 1;
+// 为true时使用DMA收发：发送为普通DMA，接收为循环DMA；未在CubeMX中配置DMA流的方向仍使用中断
+constexpr bool BSP_UARTDMAList[] = {false, false, false, false, false, false, false, false, false};
+static_assert(sizeof(BSP_UARTDMAList) == sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) * sizeof(bool), "BSP_UARTDMAList should match BSP_UARTList");
 
 /**
  * RS485 Definitions
@@ -56,6 +59,20 @@ constexpr size_t RS485_BUS_MAXIMUM_COUNT = sizeof(BSP_RS485UARTIndexList) / size
 constexpr CAN_HandleTypeDef *BSP_CANList[] = {nullptr, &hcan1, &hcan2};
 constexpr size_t CAN_BUS_MAXIMUM_COUNT = sizeof(BSP_CANList) / sizeof(BSP_CANList[0]) - 1;
 
+/**
+ * I2C Definitions
+ */
+// 下标与I2C外设编号一致；在CubeMX中配置了DMA流的方向使用DMA传输，否则使用中断
+constexpr I2C_HandleTypeDef *BSP_I2CList[] = {nullptr, nullptr, &hi2c2};
+constexpr size_t I2C_BUS_MAXIMUM_COUNT = sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]) - 1;
+// 总线恢复时以GPIO补发时钟的SCL与SDA引脚，与CubeMX中各I2C的复用引脚一致
+inline GPIO_TypeDef *const BSP_I2CSCLPortList[] = {nullptr, nullptr, GPIOF};
+constexpr uint16_t BSP_I2CSCLPinList[] = {0, 0, GPIO_PIN_1};
+inline GPIO_TypeDef *const BSP_I2CSDAPortList[] = {nullptr, nullptr, GPIOF};
+constexpr uint16_t BSP_I2CSDAPinList[] = {0, 0, GPIO_PIN_0};
+static_assert(sizeof(BSP_I2CSCLPinList) == sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]) * sizeof(uint16_t) &&
+              sizeof(BSP_I2CSDAPinList) == sizeof(BSP_I2CSCLPinList), "BSP_I2C pin lists should match BSP_I2CList");
+
 /**
  * DHSOT Definitions
  */
@@ -109,6 +126,9 @@ constexpr PWMList_t BSP_PWMList[18] = {
 /**
  * SPI Definitions
  */
+// 下标与SPI外设编号一致；收发DMA流均已配置的总线使用DMA传输，否则使用中断；SPI4、SPI5未配置DMA与中断，暂不接入
+constexpr SPI_HandleTypeDef *BSP_SPIList[] = {nullptr};
+constexpr size_t SPI_BUS_MAXIMUM_COUNT = sizeof(BSP_SPIList) / sizeof(BSP_SPIList[0]) - 1;
 
 /**
  * BUZZER Definitions
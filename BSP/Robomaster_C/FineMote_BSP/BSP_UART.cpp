@@ -23,13 +23,18 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
 
 // 出错中断回调函数
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
-    FineMoteAux_UART<>::OnRxComplete(huart, 0);
+    FineMoteAux_UART<>::OnError(huart);
 }
 
 void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t size) {
     FineMoteAux_UART<>::OnRxComplete(huart, size);
 }
 
+// 在stm32f4xx_it.c中串口及其DMA流的中断入口调用，统计中断次数
+void BSP_UART_IRQHook(UART_HandleTypeDef *huart) {
+    FineMoteAux_UART<>::OnIRQ(huart);
+}
+
 #ifdef __cplusplus
 }
 #endif
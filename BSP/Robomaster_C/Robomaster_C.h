@@ -42,6 +42,9 @@ public:
  */
 constexpr UART_HandleTypeDef *BSP_UARTList[] = {nullptr, &huart6, &huart1, &huart3};
 constexpr size_t UART_BUS_MAXIMUM_COUNT = sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) - 1;
+// 为true时使用DMA收发：发送为普通DMA，接收为循环DMA；未在CubeMX中配置DMA流的方向仍使用中断
+constexpr bool BSP_UARTDMAList[] = {false, true, true, true};
+static_assert(sizeof(BSP_UARTDMAList) == sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) * sizeof(bool), "BSP_UARTDMAList should match BSP_UARTList");
 
 /**
  * CAN Definitions
@@ -49,6 +52,27 @@ constexpr size_t UART_BUS_MAXIMUM_COUNT = sizeof(BSP_UARTList) / sizeof(BSP_UART
 constexpr CAN_HandleTypeDef *BSP_CANList[] = {nullptr, &hcan1, &hcan2};
 constexpr size_t CAN_BUS_MAXIMUM_COUNT = sizeof(BSP_CANList) / sizeof(BSP_CANList[0]) - 1;
 
+/**
+ * I2C Definitions
+ */
+// 下标与I2C外设编号一致；在CubeMX中配置了DMA流的方向使用DMA传输，否则使用中断
+constexpr I2C_HandleTypeDef *BSP_I2CList[] = {nullptr, nullptr, &hi2c2, &hi2c3};
+constexpr size_t I2C_BUS_MAXIMUM_COUNT = sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]) - 1;
+// 总线恢复时以GPIO补发时钟的SCL与SDA引脚，与CubeMX中各I2C的复用引脚一致
+inline GPIO_TypeDef *const BSP_I2CSCLPortList[] = {nullptr, nullptr, GPIOF, GPIOA};
+constexpr uint16_t BSP_I2CSCLPinList[] = {0, 0, GPIO_PIN_1, GPIO_PIN_8};
+inline GPIO_TypeDef *const BSP_I2CSDAPortList[] = {nullptr, nullptr, GPIOF, GPIOC};
+constexpr uint16_t BSP_I2CSDAPinList[] = {0, 0, GPIO_PIN_0, GPIO_PIN_9};
+static_assert(sizeof(BSP_I2CSCLPinList) == sizeof(BSP_I2CList) / sizeof(BSP_I2CList[0]) * sizeof(uint16_t) &&
+              sizeof(BSP_I2CSDAPinList) == sizeof(BSP_I2CSCLPinList), "BSP_I2C pin lists should match BSP_I2CList");
+
+/**
+ * SPI Definitions
+ */
+// 下标与SPI外设编号一致；收发DMA流均已配置的总线使用DMA传输，否则使用中断
+constexpr SPI_HandleTypeDef *BSP_SPIList[] = {nullptr, &hspi1};
+constexpr size_t SPI_BUS_MAXIMUM_COUNT = sizeof(BSP_SPIList) / sizeof(BSP_SPIList[0]) - 1;
+
 /**
  * DHSOT Definitions
  */
@@ -86,8 +110,6 @@ constexpr size_t BUZZER_PWM_ID = 8;
 #define TIM_Control htim7
 #define SPI_BMI088 hspi1 /** todo */
 
-#define USER_I2C hi2c2
-
 typedef struct {
     SPI_HandleTypeDef* spiHandle;
     DMA_HandleTypeDef* rxDMAHandle;
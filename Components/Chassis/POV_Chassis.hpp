@@ -9,7 +9,7 @@
 
 #include <array>
 #include "arm_math.h"
-#include "Matrix/matrix.h"
+#include "Matrix/SmallMatrix.hpp"
 #include "ChassisBase.hpp"
 
 using Swerve_t = struct Swerve_t {
@@ -25,24 +25,34 @@ class POV_Chassis : public ChassisBase<OdomPolicy> {
 public:
     POV_Chassis(const float _wheelDiameter, std::array<Swerve_t, N> &&configs) : modules(std::move(configs)),
         wheelDiameter(_wheelDiameter) {
-        for (int i = 0; i < N; ++i) {
-            float hnData[2 * 3] = {1, 0, -modules[i].ly, 0, 1, modules[i].lx};
-            Hn[i] = Matrixf<2, 3>(hnData);
-            Jn[i] = matrixf::eye<3, 3>();
-            Xn[i] = matrixf::zeros<3, 1>();
-        }
-
         float BData[2 * 2] = {
             100, 0,
             0, 100
         };
-        B = Matrixf<2, 2>(BData);
+        const SMatrixf<2, 2> B(BData);
         float QData[3 * 3] = {
             0.1, 0, 0,
             0, 0.1, 0,
             0, 0, 0.1
         };
-        Q = Matrixf<3, 3>(QData);
+        Q = SMatrixf<3, 3>(QData);
+
+        for (int i = 0; i < N; ++i) {
+            float hnData[2 * 3] = {1, 0, -modules[i].ly, 0, 1, modules[i].lx};
+            const SMatrixf<2, 3> Hn(hnData);
+            HtB[i] = Hn.trans() * B / N;
+            HtBH += HtB[i] * Hn;
+        }
+        P = smatrixf::eye<3, 3>();
+        X = smatrixf::zeros<3, 1>();
+    }
+
+    /**
+     * 设置估计器的分频系数，每division次Handle执行一次ForwardKinematics，逆运动学仍每次执行
+     * @note alpha与Q均按估计器的一次更新计，降低估计频率时需相应调整
+     */
+    void SetEstimatorDivision(uint32_t division) {
+        estimatorDivision = division > 0 ? division : 1;
     }
 
     void InverseKinematics(std::array<float, 3> &v) final {
@@ -72,55 +82,38 @@ public:
         }
     }
 
+    /**
+     * 各轮组的分布式信息滤波在每次融合后取得一致，各轮组的估计与信息矩阵始终相同，因此只保存一份并直接计算融合结果：
+     * 预测 X = alpha * X + (1 - alpha) * targetV，J = (alpha^2 * P + Q / 2)^-1；
+     * 融合 W = J / N + mean(Hn^T * B * Hn)，w = J / N * X + mean(Hn^T * B * vn)，X = W^-1 * w，P = W^-1 / N
+     * @note 常量项mean(Hn^T * B * Hn)与Hn^T * B / N在构造时计算；J与W均为对称正定矩阵，以inv_spd求逆，每次更新共两次
+     */
     void ForwardKinematics() final {
-        struct SwerveState {
-            float angle{0};
-            Matrixf<2, 1> vel;
-
-            SwerveState() = default;
-
-            SwerveState(const float _angle, const float _vel, const float &wheelDiameter, const float angleOffset) {
-                angle = (_angle + angleOffset) / 180.f * PI; //弧度制
-                float tmp[2]{
-                    _vel / 360.f * PI * wheelDiameter * cosf(angle),
-                    _vel / 360.f * PI * wheelDiameter * sinf(angle)
-                };
-                vel = tmp;
-            }
-        };
-
-        std::array<Matrixf<3, 3>, N> Wn;
-        std::array<Matrixf<3, 1>, N> wn;
-        std::array<SwerveState, N> states;
-
+        SMatrixf<3, 1> w;
         for (int i = 0; i < N; ++i) {
-            SwerveState swerveState_t(modules[i].steerMotor->GetState().position,
-                                      modules[i].driveMotor->GetState().speed, wheelDiameter, modules[i].zeroPosition);
-            states[i] = swerveState_t;
-            Xn[i] = alpha * Xn[i] + (1 - alpha) * Matrixf<3, 1>(this->targetV.data());
-            Jn[i] = matrixf::inv(alpha * alpha * matrixf::inv(Jn[i]) + 0.5 * Q);
-            Wn[i] = Jn[i] / N + Hn[i].trans() * B * Hn[i];
-            wn[i] = Jn[i] / N * Xn[i] + Hn[i].trans() * B * states[i].vel;
+            float angle = (modules[i].steerMotor->GetState().position + modules[i].zeroPosition) / 180.f * PI; //弧度制
+            float vel = modules[i].driveMotor->GetState().speed / 360.f * PI * wheelDiameter;
+            float vn[2] = {vel * cosf(angle), vel * sinf(angle)};
+            w += HtB[i] * SMatrixf<2, 1>(vn);
         }
 
-        Matrixf<3, 3> W_mean = matrixf::zeros<3, 3>();
-        Matrixf<3, 1> w_mean = matrixf::zeros<3, 1>();
-        for (auto W_t: Wn) W_mean += W_t / N;
-        for (auto W_t: Wn) W_t = W_mean;
-        for (auto w_t: wn) w_mean += w_t / N;
-        for (auto w_t: wn) w_t = w_mean;
+        X = alpha * X + (1 - alpha) * SMatrixf<3, 1>(this->targetV.data());
+        const SMatrixf<3, 3> J = smatrixf::inv_spd(alpha * alpha * P + 0.5f * Q) / N;
+        w += J * X;
+        const SMatrixf<3, 3> Winv = smatrixf::inv_spd(J + HtBH);
+        X = Winv * w;
+        P = Winv / N;
 
-        for (int i = 0; i < N; ++i) {
-            Xn[i] = matrixf::inv(W_mean) * w_mean;
-            Jn[i] = N * W_mean;
-        }
-        this->estimatedV[0] = Xn[0][0][0];
-        this->estimatedV[1] = Xn[0][1][0];
-        this->estimatedV[2] = Xn[0][2][0];
+        this->estimatedV[0] = X[0][0];
+        this->estimatedV[1] = X[1][0];
+        this->estimatedV[2] = X[2][0];
     }
 
     void Handle() final {
-        ForwardKinematics();
+        if (++estimatorCount >= estimatorDivision) {
+            estimatorCount = 0;
+            ForwardKinematics();
+        }
         if (!std::is_same<OdomPolicy, WithoutOdom<3>>::value) {
             this->odom.UpdateOdom(this->estimatedV, this->divisionFactor);
         }
@@ -130,13 +123,15 @@ public:
 
 private:
     std::array<Swerve_t, N> modules;
-    std::array<Matrixf<3, 3>, N> Jn;
-    std::array<Matrixf<2, 3>, N> Hn;
-    std::array<Matrixf<3, 1>, N> Xn;
-    Matrixf<3, 3> Q;
-    Matrixf<2, 2> B;
+    std::array<SMatrixf<3, 2>, N> HtB; // Hn^T * B / N
+    SMatrixf<3, 3> HtBH; // mean(Hn^T * B * Hn)
+    SMatrixf<3, 3> Q;
+    SMatrixf<3, 3> P; // 融合估计的协方差，即各轮组信息矩阵的逆
+    SMatrixf<3, 1> X;
     const float alpha = 0.5;
     const float wheelDiameter;
+    uint32_t estimatorDivision = 1;
+    uint32_t estimatorCount = 0;
 };
 
 template<typename OdomPolicy = WithoutOdom<3>, typename... Configs>
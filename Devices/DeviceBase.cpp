@@ -7,37 +7,200 @@
 #include "DeviceBase.h"
 #include "ProjectConfig.h"
 
+#include <numeric>
+
+#ifdef WITH_PROFILER
+#include "Profiler/Profiler.hpp"
+#endif
+
 uint32_t DeviceBase::baseFre = 0;
 
+std::array<DeviceBase *, DEVICE_REGISTRY_SIZE> DeviceBase::registry = {};
+std::array<DeviceBase *, DEVICE_WHEEL_SIZE> DeviceBase::wheel = {};
+std::array<DeviceBase *, DEVICE_WHEEL_SIZE> DeviceBase::wheelTail = {};
+size_t DeviceBase::deviceCount = 0;
+uint32_t DeviceBase::registryOverflow = 0;
+uint32_t DeviceBase::registerCount = 0;
+uint32_t DeviceBase::tick = 0;
+bool DeviceBase::frozen = false;
+DeviceBase::TickLoad_t DeviceBase::tickLoad = {0, 0, 0};
+
 void DeviceBase::DevicesHandle() {
-    //auto tmp = getDeviceList().size()
     static uint32_t stamp = HAL_GetTick();
     static uint32_t cnt = 0;
+    static uint32_t handledCnt = 0;
     uint32_t diff = HAL_GetTick() - stamp;
     cnt++;
     if (diff >= 1000) {
         baseFre = cnt;
+        tickLoad.average = static_cast<float>(handledCnt) / cnt;
         stamp = HAL_GetTick();
         cnt = 0;
+        handledCnt = 0;
+    }
+
+    if (!frozen) {
+        Freeze();
     }
-    for (auto rit = getDeviceList().rbegin(); rit != getDeviceList().rend(); ++rit) {//反向遍历
-        auto devicePtr = *rit;
-        if (++(devicePtr->cnt) >= devicePtr->divisionFactor) {
+
+    // 取下当前槽位的设备链表，只遍历本周期可能到期的设备，执行后按新的到期时刻重新挂入时间轮
+    tick++;
+    DeviceBase *devicePtr = wheel[tick & (DEVICE_WHEEL_SIZE - 1)];
+    wheel[tick & (DEVICE_WHEEL_SIZE - 1)] = nullptr;
+    wheelTail[tick & (DEVICE_WHEEL_SIZE - 1)] = nullptr;
+    uint32_t load = 0;
+    while (devicePtr != nullptr) {
+        DeviceBase *nextPtr = devicePtr->next;
+        if (devicePtr->dueTick == tick) {
+#ifdef WITH_PROFILER
+            uint32_t start = Profiler<>::GetInstance().Begin();
+            devicePtr->Handle();
+            Profiler<>::GetInstance().RecordDevice(devicePtr->order - 1, start);
+#else
             devicePtr->Handle();
-            devicePtr->cnt = 0;
+#endif
+            devicePtr->dueTick = tick + devicePtr->divisionFactor;
+            load++;
         }
+        Schedule(devicePtr);
+        devicePtr = nextPtr;
     }
+
+    tickLoad.last = load;
+    if (load > tickLoad.peak) {
+        tickLoad.peak = load;
+    }
+    handledCnt += load;
 }
+
+void DeviceBase::Freeze() {
+    if (frozen) {
+        return;
+    }
+    AssignPhases();
+    // 按注册顺序逆序挂入，与原先反向遍历的执行顺序相同
+    for (size_t i = deviceCount; i-- > 0;) {
+        // 首次执行时刻为 tick 之后第一个满足 t % divisionFactor == phase 的周期
+        DeviceBase *device = registry[i];
+        uint32_t first = tick + 1;
+        device->dueTick = first + (device->phase + device->divisionFactor - first % device->divisionFactor) % device->divisionFactor;
+        Schedule(device);
+    }
+    frozen = true;
+}
+
+/**
+ * 按分频系数从小到大依次为设备选择相位，使其与已放置设备同周期执行的期望数量最小
+ * @note 两设备分频系数为 Di, Dj，g = gcd(Di, Dj)，当 (pi - pj) % g == 0 时，
+ *       设备i每次执行时设备j同时执行的概率为 g / Dj，否则两者永不重合
+ */
+void DeviceBase::AssignPhases() {
+    std::array<bool, DEVICE_REGISTRY_SIZE> placed = {};
+
+    for (size_t n = 0; n < deviceCount; ++n) {
+        size_t index = deviceCount;
+        for (size_t i = 0; i < deviceCount; ++i) {
+            if (!placed[i] && (index == deviceCount || registry[i]->divisionFactor < registry[index]->divisionFactor)) {
+                index = i;
+            }
+        }
+        DeviceBase *device = registry[index];
+        placed[index] = true;
+
+        if (device->phaseFixed || device->divisionFactor == 1) {
+            device->phase %= device->divisionFactor;
+            continue;
+        }
+
+        uint32_t bestPhase = 0;
+        float bestCost = 0;
+        for (uint32_t p = 0; p < device->divisionFactor; ++p) {
+            float cost = 0;
+            for (size_t j = 0; j < deviceCount; ++j) {
+                DeviceBase *other = registry[j];
+                // 指定相位的设备无论是否已放置，其相位均已确定，始终计入
+                if ((!placed[j] && !other->phaseFixed) || j == index || other->divisionFactor == 1) {
+                    continue;
+                }
+                uint32_t g = std::gcd(device->divisionFactor, other->divisionFactor);
+                if ((p + g - other->phase % g) % g == 0) {
+                    cost += static_cast<float>(g) / other->divisionFactor;
+                }
+            }
+            if (p == 0 || cost < bestCost) {
+                bestCost = cost;
+                bestPhase = p;
+            }
+        }
+        device->phase = bestPhase;
+    }
+}
+
+/**
+ * 追加于槽位队尾，DevicesHandle按槽内顺序取下并依次挂入，因此同一分频系数的设备始终保持冻结时的注册顺序逆序；
+ * 分频系数不同的设备在同一周期到期时，分频系数大者较早挂入，先于其余设备执行
+ */
+void DeviceBase::Schedule(DeviceBase *device) {
+    size_t slot = device->dueTick & (DEVICE_WHEEL_SIZE - 1);
+    device->next = nullptr;
+    if (wheelTail[slot] != nullptr) {
+        wheelTail[slot]->next = device;
+    } else {
+        wheel[slot] = device;
+    }
+    wheelTail[slot] = device;
+}
+
+void DeviceBase::Unschedule(DeviceBase *device) {
+    size_t slot = device->dueTick & (DEVICE_WHEEL_SIZE - 1);
+    DeviceBase *prev = nullptr;
+    for (DeviceBase **link = &wheel[slot]; *link != nullptr; link = &(*link)->next) {
+        if (*link == device) {
+            *link = device->next;
+            if (wheelTail[slot] == device) {
+                wheelTail[slot] = prev;
+            }
+            device->next = nullptr;
+            return;
+        }
+        prev = *link;
+    }
+}
+
 DeviceBase::DeviceBase() {
-    getDeviceList().push_back(this);
-	auto tmp = getDeviceList().size();
+    if (deviceCount >= DEVICE_REGISTRY_SIZE) {
+        registryOverflow++;
+        return;
+    }
+    registry[deviceCount++] = this;
+    order = ++registerCount;
+
+    if (frozen) {
+        dueTick = tick + divisionFactor;
+        Schedule(this);
+    }
 }
 
 DeviceBase::~DeviceBase() {
-    auto tmp = getDeviceList().size();
-    getDeviceList().remove(this);
+    for (size_t i = 0; i < deviceCount; ++i) {
+        if (registry[i] == this) {
+            for (size_t j = i + 1; j < deviceCount; ++j) {
+                registry[j - 1] = registry[j];
+            }
+            registry[--deviceCount] = nullptr;
+            if (frozen) {
+                Unschedule(this);
+            }
+            return;
+        }
+    }
 }
 
 void DeviceBase::SetDivisionFactor(uint32_t divisionFactor) {
-    DeviceBase::divisionFactor = divisionFactor;
+    DeviceBase::divisionFactor = divisionFactor > 0 ? divisionFactor : 1;
+}
+
+void DeviceBase::SetPhase(uint32_t phase) {
+    DeviceBase::phase = phase;
+    phaseFixed = true;
 }
@@ -7,7 +7,14 @@
 #ifndef FINEMOTE_DEVICEBASE_H
 #define FINEMOTE_DEVICEBASE_H
 
-#include <list>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#define DEVICE_REGISTRY_SIZE 48
+#define DEVICE_WHEEL_SIZE 32
+
+static_assert((DEVICE_WHEEL_SIZE & (DEVICE_WHEEL_SIZE - 1)) == 0, "DEVICE_WHEEL_SIZE must be a power of 2");
 
 class DeviceBase {
 public:
@@ -19,25 +26,86 @@ public:
     virtual ~DeviceBase();
 
     /**
-     * 惰性初始化，避免静态变量初始化顺序问题
-     * @return
+     * 冻结设备注册表，按各设备的分频系数与相位生成调度时间轮
+     * @note 首次调用DevicesHandle时会自动冻结，冻结后注册的设备直接插入时间轮
+     */
+    static void Freeze();
+
+    static size_t GetDeviceCount() {
+        return deviceCount;
+    }
+
+    /**
+     * 超出DEVICE_REGISTRY_SIZE而未能注册的设备数量，非零时需增大DEVICE_REGISTRY_SIZE
      */
-    static std::list<DeviceBase*>& getDeviceList() {
-        static std::list<DeviceBase*> deviceList;
-        return deviceList;
+    static uint32_t GetRegistryOverflow() {
+        return registryOverflow;
     }
-    
+
+    /**
+     * 每个调度周期实际执行的设备数，统计窗口与baseFre相同
+     */
+    struct TickLoad_t {
+        uint32_t last;      // 上一周期执行的设备数
+        uint32_t peak;      // 冻结以来单周期执行的最大设备数
+        float average;      // 最近一秒内的平均值
+    };
+
+    static const TickLoad_t &GetTickLoad() {
+        return tickLoad;
+    }
+
     /**
      * 设置分频系数，使设备的执行频率动态可调
      * @param divisionFactor
+     * @note 冻结后修改的分频系数在设备下一次执行后生效
      */
     void SetDivisionFactor(uint32_t divisionFactor);
 
+    /**
+     * 显式指定相位，设备在 tick % divisionFactor == phase 的周期执行
+     * @param phase
+     * @note 未指定相位的设备将在冻结时自动分配相位，使各周期的负载均衡；需在冻结前调用
+     */
+    void SetPhase(uint32_t phase);
+
+    uint32_t GetPhase() const {
+        return phase;
+    }
+
+    /**
+     * 设备的注册序号，从0开始，同时作为性能统计中设备的编号
+     */
+    uint32_t GetRegisterIndex() const {
+        return order - 1;
+    }
+
 protected:
     uint32_t divisionFactor = 1;
 
 private:
-    uint32_t cnt = 0;
+    static void AssignPhases();
+    static void Schedule(DeviceBase *device);
+    static void Unschedule(DeviceBase *device);
+
+    /**
+     * 注册表与时间轮均为常量初始化的静态数组，不存在静态变量初始化顺序问题
+     */
+    static std::array<DeviceBase *, DEVICE_REGISTRY_SIZE> registry;
+    static std::array<DeviceBase *, DEVICE_WHEEL_SIZE> wheel;
+    static std::array<DeviceBase *, DEVICE_WHEEL_SIZE> wheelTail;
+    static size_t deviceCount;
+    static uint32_t registryOverflow;
+    static uint32_t registerCount;
+    static uint32_t tick;
+    static bool frozen;
+    static TickLoad_t tickLoad;
+
+    DeviceBase *next = nullptr; // 同一时间轮槽位中的下一个设备，按挂入顺序排列
+    uint32_t dueTick = 0;
+    uint32_t order = 0;
+    uint32_t phase = 0;
+    bool phaseFixed = false;
 };
 
 #endif //FINEMOTE_DEVICEBASE_H
@@ -15,13 +15,14 @@ class Emm28 : public MotorBase {
 public:
     template <typename T>
     Emm28(const Motor_Param_t&& params, T& _controller, uint32_t addr) :
-        MotorBase(std::forward<const Motor_Param_t>(params)), canAgent(addr) {
+        MotorBase(std::forward<const Motor_Param_t>(params)), canAgent(addr, CAN_ID_EXT) {
         ResetController(_controller);
     }
 
     void Handle() final {
         Update();
-        controller->Calc();
+        CheckHealth();
+        CalcController();
         MessageGenerate();
         GetCurrentPosition();
     }
@@ -29,12 +30,12 @@ public:
     CAN_Agent<busID> canAgent;
 
 private:
-    void SetFeedback() final {
+    FeedbackList_t GetFeedback() final {
         switch (params.targetType) {
         case Motor_Ctrl_Type_e::Position:
-            controller->SetFeedback({&state.position, &state.position});
-            break;
+            return {&state.position, &state.position};
         }
+        return {};
     }
 
     void MessageGenerate() {
@@ -74,9 +75,16 @@ private:
     }
 
     void Update() {
-        if (canAgent.rxbuf[2] != 0xEE) {
-            float tmp = ((canAgent.rxbuf[2] << 24u) | (canAgent.rxbuf[3] << 16u) | (canAgent.rxbuf[4] << 8u) | (canAgent.rxbuf[5])) * 360.0f / 65536.0f;
-            tmp *= canAgent.rxbuf[1] == 0x00 ? -1 : 1;
+        CAN_RxFrame_t frame;
+        uint32_t count = canAgent.Read(frame);
+        if (count == 0) {
+            return;
+        }
+        Feed(frame.timestamp, count);
+        const uint8_t *rx = frame.data;
+        if (rx[2] != 0xEE) {
+            float tmp = ((rx[2] << 24u) | (rx[3] << 16u) | (rx[4] << 8u) | (rx[5])) * 360.0f / 65536.0f;
+            tmp *= rx[1] == 0x00 ? -1 : 1;
             state.position = fmod(tmp, 360.);
         }
     }
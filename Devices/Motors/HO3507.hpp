@@ -26,7 +26,8 @@ public:
 
     void Handle() final{
         Update();
-        controller->Calc();
+        CheckHealth();
+        CalcController();
         if (HAL_GetTick() - initTick < 5000){
             ChooseCtrlType();
             Start();
@@ -41,15 +42,14 @@ public:
 
 private:
     uint32_t initTick;
-    void SetFeedback() final{
+    FeedbackList_t GetFeedback() final {
         switch (params.targetType){
         case Motor_Ctrl_Type_e::Position:
-            controller->SetFeedback({&state.position, &state.speed});
-            break;
+            return {&state.position, &state.speed};
         case Motor_Ctrl_Type_e::Speed:
-            controller->SetFeedback({&state.speed});
-            break;
+            return {&state.speed};
         }
+        return {};
     }
 
     /**
@@ -143,15 +143,22 @@ private:
                 break;
             }
         }
-        canAgent.Transmit(canAgent.addr);
+        canAgent.TransmitLatest(canAgent.addr);
     }
 
     void Update(){  //正方向取CCW
-        int16_t position_code = (canAgent.rxbuf[1] << 8) | canAgent.rxbuf[2];
+        CAN_RxFrame_t frame;
+        uint32_t count = canAgent.Read(frame);
+        if (count == 0) {
+            return;
+        }
+        Feed(frame.timestamp, count);
+        const uint8_t *rx = frame.data;
+        int16_t position_code = (rx[1] << 8) | rx[2];
         state.position = -static_cast<float>(position_code - 0x8000) / 32768.0f * 360.0f;
-        int16_t speed_code = (canAgent.rxbuf[3] << 4) | ((canAgent.rxbuf[4] >> 4) & 0x0F);
+        int16_t speed_code = (rx[3] << 4) | ((rx[4] >> 4) & 0x0F);
         state.speed = -static_cast<float>(speed_code - 0x800) / 2048.0f * 58.639f;
-        int16_t torque_code = (((canAgent.rxbuf[4]) & 0xF0) << 4) | canAgent.rxbuf[5];
+        int16_t torque_code = (((rx[4]) & 0xF0) << 4) | rx[5];
         state.torque = -static_cast<float>(torque_code - 0x800) / 2048.0f * 4.0f;
     }
 };
@@ -11,66 +11,45 @@
 #include "Bus/RS485_Base.hpp"
 #include "Verification/CRC.h"
 
-#define MOTOR_MAP_LENGTH 10
-
-template<uint8_t ID>
-class HTMotorProxy_RS485 {
-public:
-    HTMotorProxy_RS485(MotorBase* motor, uint8_t addr) {
-        getMotorMap().insert(etl::make_pair(addr, motor));
-    }
-
-    static void Transmit(uint8_t *data, size_t size) {
-        static RS485_Agent<ID> rs485Agent(0x3C, [](uint8_t *data, size_t size) {
-            Decode(data, size);
-        });
-        rs485Agent.Transmit(data, size);
-    }
-
-private:
-    static etl::map<uint8_t, MotorBase*, MOTOR_MAP_LENGTH>& getMotorMap() {
-        static etl::map<uint8_t, MotorBase*, MOTOR_MAP_LENGTH> instance;
-        return instance;
-    }
-
-    static void Decode(uint8_t* data, size_t size) {
-        auto& motorMap = getMotorMap();
-        if(CRC16Calc(data, 13) == (data[13] | data[14] << 8u) && motorMap.contains(data[2])) {
-            MotorBase *motor = motorMap[data[2]];
-            if (data[3] == 0x55) {
-                motor->GetState().position = -1 * ((data[7] | (data[8] << 8u) | (data[9] << 16u) | (data[10] << 24u)) * 360.0f / 16384.0f);
-                motor->GetState().speed = -1 * static_cast<int16_t>(data[11] | (data[12] << 8u));
-                motor->GetState().torque = 0; //电机应答不返回电流值
-                motor->GetState().temperature = 0; //电机应答不返回温度参数
-            }
-        }
-    }
-};
-
-
 template<uint8_t BusID>
 class Motor4315 : public MotorBase {
 public:
     template<typename T>
-    Motor4315(const Motor_Param_t&& params, T &_controller, uint8_t addr) : MotorBase(std::forward<const Motor_Param_t>(params)), id(addr), commuAgent(this, addr) { // Todo: ID和地址分离逻辑
+    Motor4315(const Motor_Param_t&& params, T &_controller, uint8_t addr) : MotorBase(std::forward<const Motor_Param_t>(params)), id(addr),
+        commuAgent(addr, [this](uint8_t *data, size_t size) { Decode(data, size); }, RESPONSE_LENGTH) { // Todo: ID和地址分离逻辑
         ResetController(_controller);
+        // 总线上的事务由RS485_Base按应答时间连续调度，指令以最新值覆盖未发出的旧指令，此处只决定控制量的更新频率；
+        // 现有控制器的增益按20分频整定，提高频率时需重新整定积分与微分增益
         this->SetDivisionFactor(20);
     }
 
     void Handle() override {
-        controller->Calc();
+        CheckHealth();
+        CalcController();
         MessageGenerate();
     }
 
 private:
-    uint8_t txbuf[11] = {};
+    static constexpr uint16_t RESPONSE_LENGTH = 15;
+
+    void Decode(uint8_t* data, size_t size) {
+        if(size == RESPONSE_LENGTH && CRC16Calc(data, 13) == (data[13] | data[14] << 8u) && data[2] == id) {
+            if (data[3] == 0x55) {
+                state.position = -1 * ((data[7] | (data[8] << 8u) | (data[9] << 16u) | (data[10] << 24u)) * 360.0f / 16384.0f);
+                state.speed = -1 * static_cast<int16_t>(data[11] | (data[12] << 8u));
+                state.torque = 0; //电机应答不返回电流值
+                state.temperature = 0; //电机应答不返回温度参数
+                Feed(HAL_GetTick());
+            }
+        }
+    }
 
-    void SetFeedback() override {
+    FeedbackList_t GetFeedback() override {
         switch (params.ctrlType) {
         case Motor_Ctrl_Type_e::Position:
-            controller->SetFeedback({&state.position});
-            break;
+            return {&state.position};
         }
+        return {};
     }
 
     void MessageGenerate() {
@@ -79,6 +58,10 @@ private:
                 float targetAngle = -1 * controller->GetOutput();
                 int32_t txAngle = targetAngle * 16384.0f / 360.0;
 
+                uint8_t *txbuf = commuAgent.AcquireTxBuffer();
+                if (txbuf == nullptr) {
+                    break;
+                }
                 txbuf[0] = 0x3E; //协议头
                 txbuf[1] = 0x00; //包序号
                 txbuf[2] = id; //ID
@@ -91,14 +74,14 @@ private:
                 uint16_t crc16 = CRC16Calc(txbuf, 9);
                 txbuf[9] = crc16;
                 txbuf[10] = crc16 >> 8u;
-                commuAgent.Transmit(txbuf, 11);
+                commuAgent.Commit(txbuf, 11);
                 break;
             }
         }
     }
 
     const uint8_t id;
-    HTMotorProxy_RS485<BusID> commuAgent;
+    RS485_Agent<BusID> commuAgent;
 };
 
 #endif
@@ -1,9 +1,13 @@
 #ifndef FINEMOTE_MOTORBASE_H
 #define FINEMOTE_MOTORBASE_H
 
+#include "Board.h"
 #include "DeviceBase.h"
 #include "Control/ControlBase.hpp"
 
+#define MOTOR_OFFLINE_PERIODS 10        // 超过该数量的反馈周期未收到反馈即判为掉线
+#define MOTOR_HEALTH_WINDOW_MS 1000     // 反馈频率的统计窗口
+
 enum class Motor_Ctrl_Type_e: uint16_t {
     Position = 0,
     Speed,
@@ -15,8 +19,25 @@ typedef struct {
     float speed; //单位为DPS
     float torque; //转矩电流的相对值，具体值参考电调手册
     int8_t temperature; //电机温度，单位摄氏度
+    uint32_t timestamp; //最近一次反馈的接收时间，HAL_GetTick()
 } Motor_State_t;
 
+enum class Motor_Link_e : uint8_t {
+    Unknown = 0,    //尚未收到反馈
+    Online,
+    Offline,        //超时未收到反馈，包括开始控制后始终未收到反馈
+};
+
+typedef struct {
+    Motor_Link_e link;
+    uint32_t frames;        //收到的反馈帧数
+    uint32_t lost;          //按反馈间隔与期望周期估计的丢帧数
+    uint32_t offlineCount;  //掉线次数
+    float rate;             //上一统计窗口内的反馈频率，单位Hz
+    float jitter;           //反馈间隔与期望周期之差的绝对值的滑动平均，单位ms
+    uint32_t maxInterval;   //最大反馈间隔，单位ms
+} Motor_Health_t;
+
 using Motor_Param_t = struct Motor_Param_t {
     Motor_Ctrl_Type_e ctrlType; //控制电机的方式
     Motor_Ctrl_Type_e targetType; //控制电机哪个状态
@@ -30,13 +51,25 @@ public:
 
     }
 
+    /**
+     * 绑定控制器，控制周期内以具体类型计算，不经过虚函数
+     * @note 电机按控制方式给出由外环到内环的反馈表，控制器使用其中前T::FEEDBACKS个；反馈不足时不计算，控制量保持为零
+     * @return 反馈个数是否满足控制器的级联层数
+     */
     template<typename T>
-    void ResetController(T& _controller) {
+    bool ResetController(T& _controller) {
         static_assert(!std::is_same<ControllerBase, T>::value, "ControllerBase itself is not allowed as a controller");
 
         controller = &_controller;
+        calc = nullptr;
+        FeedbackList_t feedbackPtrs = this->GetFeedback();
+        if (feedbackPtrs.size() < T::FEEDBACKS) {
+            return false;
+        }
         _controller.SetTarget(&target);
-        this->SetFeedback();
+        _controller.SetFeedback(feedbackPtrs);
+        calc = &ControllerCalc<T>;
+        return true;
     }
 
     void Stop() {
@@ -48,7 +81,7 @@ public:
                 SetTargetSpeed(0);
                 break;
             case Motor_Ctrl_Type_e::Torque:
-                /** ToDo */
+                target = 0;
                 break;
         }
     }
@@ -63,14 +96,14 @@ public:
 
     /** Todo: 筛查电机控制类型，不合理调用的Set需要警告 */
     void SetTargetSpeed(float targetSpeed) {
-        if(params.targetType != Motor_Ctrl_Type_e::Speed) {
+        if(params.targetType != Motor_Ctrl_Type_e::Speed || health.link == Motor_Link_e::Offline) {
             return;
         }
         target = targetSpeed * params.reductionRatio; //多圈目标，减速后
     }
 
     void SetTargetAngle(float targetAngle) {
-        if(params.targetType != Motor_Ctrl_Type_e::Position) {
+        if(params.targetType != Motor_Ctrl_Type_e::Position || health.link == Motor_Link_e::Offline) {
             return;
         }
         target = targetAngle * params.reductionRatio; //多圈目标，减速后
@@ -93,13 +126,125 @@ public:
         return state.position / params.reductionRatio;
     }
 
+    bool IsOnline() const {
+        return health.link == Motor_Link_e::Online;
+    }
+
+    const Motor_Health_t &GetHealth() const {
+        return health;
+    }
+
+    /**
+     * 期望的反馈周期，默认为电机的控制周期，适用于每条指令应答一帧反馈的电机；主动上报的电机按上报周期设置
+     */
+    void SetFeedbackPeriod(uint32_t ms) {
+        feedbackPeriod = ms;
+    }
+
+    /**
+     * 掉线判定时间，默认为MOTOR_OFFLINE_PERIODS个反馈周期，0表示不做掉线判定
+     */
+    void SetOfflineTimeout(uint32_t ms) {
+        offlineTimeout = ms;
+        offlineTimeoutSet = true;
+    }
+
 protected:
-    virtual void SetFeedback() = 0;
+    /**
+     * @return 当前控制方式下由外环到内环的反馈量，只在绑定控制器时调用
+     */
+    virtual FeedbackList_t GetFeedback() = 0;
+
+    /**
+     * 在Handle中计算控制量
+     */
+    void CalcController() {
+        if (calc != nullptr) {
+            calc(*controller);
+        }
+    }
+
+    /**
+     * 驱动收到新反馈后调用，可在接收中断中调用
+     * @param timestamp 反馈的接收时间，HAL_GetTick()
+     * @param count 自上次调用以来收到的帧数，只取最新一帧解析时大于1
+     */
+    void Feed(uint32_t timestamp, uint32_t count = 1) {
+        if (health.frames > 0) {
+            uint32_t interval = timestamp - state.timestamp;
+            uint32_t expected = GetFeedbackPeriod();
+            uint32_t periods = (interval + expected / 2) / expected;
+            if (periods > count) {
+                health.lost += periods - count;
+            }
+            if (interval > health.maxInterval) {
+                health.maxInterval = interval;
+            }
+            float deviation = static_cast<float>(interval) / count - expected;
+            health.jitter += ((deviation < 0 ? -deviation : deviation) - health.jitter) / 16;
+        }
+        health.frames += count;
+        state.timestamp = timestamp;
+        health.link = Motor_Link_e::Online;
+    }
+
+    /**
+     * 在Handle中计算控制量之前调用，超时未收到反馈时转入掉线状态并安全停止
+     * @note 尚未收到反馈时从首次调用起计时，ID错误、未上电或接线断开而始终没有反馈的电机同样判为掉线
+     * @note 掉线期间目标值保持在掉线时的状态，速度与转矩反馈置零，控制器每周期复位，控制量为零或保持原位；
+     *       驱动照常发送指令，以便应答式的电机恢复后重新上线
+     */
+    void CheckHealth() {
+        uint32_t now = HAL_GetTick();
+        if (!started) {
+            started = true;
+            startTime = now;
+        }
+        if (now - windowStart >= MOTOR_HEALTH_WINDOW_MS) {
+            health.rate = static_cast<float>(health.frames - windowFrames) * 1000.f / (now - windowStart);
+            windowStart = now;
+            windowFrames = health.frames;
+        }
+
+        uint32_t timeout = offlineTimeoutSet ? offlineTimeout : MOTOR_OFFLINE_PERIODS * GetFeedbackPeriod();
+        uint32_t lastFeed = health.frames > 0 ? state.timestamp : startTime;
+        if (health.link != Motor_Link_e::Offline && timeout > 0 && now - lastFeed > timeout) {
+            Stop();
+            health.link = Motor_Link_e::Offline;
+            health.offlineCount++;
+        }
+        if (health.link == Motor_Link_e::Offline) {
+            state.speed = 0;
+            state.torque = 0;
+            controller->Reset();
+        }
+    }
 
     float target = 0; //多圈目标，减速后
-    Motor_State_t state = {0, 0, 0, 0}; //单圈状态，不考虑减速
+    Motor_State_t state = {0, 0, 0, 0, 0}; //单圈状态，不考虑减速
     Motor_Param_t params;
     ControllerBase* controller = nullptr;
+
+private:
+    const float& (*calc)(ControllerBase&) = nullptr;
+
+    uint32_t GetFeedbackPeriod() const {
+        if (feedbackPeriod > 0) {
+            return feedbackPeriod;
+        }
+        uint32_t fre = baseFre > 0 ? baseFre : 1000;
+        uint32_t period = divisionFactor * 1000 / fre;
+        return period > 0 ? period : 1;
+    }
+
+    Motor_Health_t health = {Motor_Link_e::Unknown, 0, 0, 0, 0, 0, 0};
+    uint32_t feedbackPeriod = 0;
+    uint32_t offlineTimeout = 0;
+    bool offlineTimeoutSet = false;
+    uint32_t windowStart = 0;
+    uint32_t windowFrames = 0;
+    bool started = false;
+    uint32_t startTime = 0;     //首次CheckHealth的时刻，尚未收到反馈时的计时起点
 };
 
 #endif
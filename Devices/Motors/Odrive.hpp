@@ -22,22 +22,22 @@ public:
 
     void Handle() final{
         Update();
-        controller->Calc();
+        CheckHealth();
+        CalcController();
         MessageGenerate();
     }
 
     CAN_Agent<busID> canAgent;
 
 private:
-    void SetFeedback() final{
+    FeedbackList_t GetFeedback() final {
         switch (params.targetType) {
             case Motor_Ctrl_Type_e::Position:
-                controller->SetFeedback({&state.position, &state.speed});
-                break;
+                return {&state.position, &state.speed};
             case Motor_Ctrl_Type_e::Speed:
-                controller->SetFeedback({&state.speed});
-                break;
+                return {&state.speed};
         }
+        return {};
     }
 
     void MessageGenerate() {
@@ -54,7 +54,7 @@ private:
                 canAgent[5] = 0x00;
                 canAgent[6] = 0x00;
                 canAgent[7] = 0x00;
-                canAgent.Transmit(canAgent.addr << 5 | 0x00e,CAN_ID_STD | CAN_RTR_DATA);
+                canAgent.TransmitLatest(canAgent.addr << 5 | 0x00e,CAN_ID_STD | CAN_RTR_DATA);
                 break;
             }
             case Motor_Ctrl_Type_e::Position: {
@@ -68,7 +68,7 @@ private:
                 canAgent[5] = 0x00;
                 canAgent[6] = 0x00;
                 canAgent[7] = 0x00;
-                canAgent.Transmit(canAgent.addr << 5 | 0x00c,CAN_ID_STD | CAN_RTR_DATA);
+                canAgent.TransmitLatest(canAgent.addr << 5 | 0x00c,CAN_ID_STD | CAN_RTR_DATA);
                 break;
             }
             case Motor_Ctrl_Type_e::Speed: {
@@ -82,7 +82,7 @@ private:
                 canAgent[5] = 0x00;
                 canAgent[6] = 0x00;
                 canAgent[7] = 0x00;
-                canAgent.Transmit(canAgent.addr << 5 | 0x00d,CAN_ID_STD | CAN_RTR_DATA);
+                canAgent.TransmitLatest(canAgent.addr << 5 | 0x00d,CAN_ID_STD | CAN_RTR_DATA);
                 break;
             }
         }
@@ -90,11 +90,18 @@ private:
     }
 
     void Update() {
-        uint32_t position_data = (canAgent.rxbuf[0] | (canAgent.rxbuf[1] << 8u) | (canAgent.rxbuf[2] << 16u) | (canAgent.rxbuf[3] << 24u));
+        CAN_RxFrame_t frame;
+        uint32_t count = canAgent.Read(frame);
+        if (count == 0) {
+            return;
+        }
+        Feed(frame.timestamp, count);
+        const uint8_t *rx = frame.data;
+        uint32_t position_data = (rx[0] | (rx[1] << 8u) | (rx[2] << 16u) | (rx[3] << 24u));
         float position_float = *reinterpret_cast<float*>(&position_data);
         state.position = position_float;
 
-        uint32_t speed_data = (canAgent.rxbuf[4] | (canAgent.rxbuf[5] << 8u) | (canAgent.rxbuf[6] << 16u) | (canAgent.rxbuf[7] << 24u));
+        uint32_t speed_data = (rx[4] | (rx[5] << 8u) | (rx[6] << 16u) | (rx[7] << 24u));
         float speed_float = *reinterpret_cast<float*>(&speed_data);
         state.speed = speed_float;
     }
@@ -24,30 +24,49 @@ public:
         ResetController(_controller);
     }
 
+    /**
+     * 转矩控制时加入多电机分组指令(0x280)，与同一分组的其他电机共用一帧发送
+     * @note 分组内的电机统一使用相位0，保证在同一控制周期内写入
+     * @note 标识符不在0x241~0x244时无法加入分组，仍发送单独的0xA1转矩指令
+     */
+    template<typename T>
+    RMD_L_40xx_v3(const Motor_Param_t&& params, T& _controller, uint32_t addr, CAN_GroupAgent<busID>& _group) : RMD_L_40xx_v3(std::forward<const Motor_Param_t>(params), _controller, addr) {
+        if (params.ctrlType == Motor_Ctrl_Type_e::Torque && addr >= 0x241 && _group.Join(addr - 0x241)) {
+            group = &_group;
+            SetPhase(0);
+        }
+    }
+
     void Handle() final{
         Update();
-        controller->Calc();
+        CheckHealth();
+        CalcController();
         MessageGenerate();
     };
 
     CAN_Agent<busID> canAgent;
 
 private:
-    void SetFeedback() final{
+    CAN_GroupAgent<busID> *group = nullptr;
+
+    FeedbackList_t GetFeedback() final {
         switch (params.targetType) {
             case Motor_Ctrl_Type_e::Position:
-                controller->SetFeedback({&state.position, &state.speed});
-                break;
+                return {&state.position, &state.speed};
             case Motor_Ctrl_Type_e::Speed:
-                controller->SetFeedback({&state.speed});
-                break;
+                return {&state.speed};
         }
+        return {};
     }
 
     void MessageGenerate() {
         switch (params.ctrlType) {
             case Motor_Ctrl_Type_e::Torque: {
                 int16_t txTorque = Clamp(1 * controller->GetOutput(), -1000.f, 1000.f);
+                if (group != nullptr) {
+                    group->Write(canAgent.addr - 0x241, txTorque);
+                    return;
+                }
 
                 canAgent[0] = 0xA1;
                 canAgent[1] = 0x00;
@@ -74,14 +93,21 @@ private:
                 break;
             }
         }
-        canAgent.Transmit(canAgent.addr - 0x100);
+        canAgent.TransmitLatest(canAgent.addr - 0x100);
     }
 
     void Update() {
-        state.position = static_cast<int16_t>(canAgent.rxbuf[6] | (canAgent.rxbuf[7] << 8u)) / 65536.0f * 360.0f;
-        state.speed = static_cast<int16_t>(canAgent.rxbuf[4] | (canAgent.rxbuf[5] << 8u));
-        state.torque = static_cast<int16_t>(canAgent.rxbuf[2] | (canAgent.rxbuf[3] << 8u));
-        state.temperature = static_cast<int8_t>(canAgent.rxbuf[1]);
+        CAN_RxFrame_t frame;
+        uint32_t count = canAgent.Read(frame);
+        if (count == 0) {
+            return;
+        }
+        Feed(frame.timestamp, count);
+        const uint8_t *rx = frame.data;
+        state.position = static_cast<int16_t>(rx[6] | (rx[7] << 8u)) / 65536.0f * 360.0f;
+        state.speed = static_cast<int16_t>(rx[4] | (rx[5] << 8u));
+        state.torque = static_cast<int16_t>(rx[2] | (rx[3] << 8u));
+        state.temperature = static_cast<int8_t>(rx[1]);
     }
 };
 
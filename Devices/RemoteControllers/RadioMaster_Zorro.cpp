@@ -8,7 +8,7 @@
 #include <cmath>
 
 void RadioMaster_Zorro::Decode(uint8_t* data, uint16_t length) {
-    if(data[0] != 0x0F || data[24] != 0x00){return;}
+    if(!FrameCheck(data, length)){return;}
     info.rR = (((data[1] | (data[2] << 8)) & 0x07FF) - 1000) / 810.0f;
     info.rC = ((((data[2] >> 3) | (data[3] << 5)) & 0x07FF) - 1000) / 810.0f;
     info.lC = ((((data[3] >> 6) | (data[4] << 2) | (data[5] << 10)) & 0x07FF) - 1000) / 810.0f;
@@ -9,13 +9,32 @@
 
 #include "ProjectConfig.h"
 #include "RemoteControl.h"
+#include "FrameExtractor.hpp"
 
 class RadioMaster_Zorro : public RemoteControl{
 public:
     RadioMaster_Zorro() {}
     void Decode(uint8_t* data, uint16_t length) override;
 
+    /**
+     * SBUS帧：帧头0x0F，定长25字节，帧尾0x00
+     */
+    static constexpr FrameFormat_t FrameFormat() {
+        return {SBUS_HEADER, 1, FrameLength, FrameCheck};
+    }
+
+    static size_t FrameLength(const uint8_t *prefix) {
+        return SBUS_FRAME_LENGTH;
+    }
+
+    static bool FrameCheck(const uint8_t *data, size_t size) {
+        return size == SBUS_FRAME_LENGTH && data[0] == SBUS_HEADER && data[SBUS_FRAME_LENGTH - 1] == SBUS_FOOTER;
+    }
+
 private:
+    static constexpr uint8_t SBUS_HEADER = 0x0F;
+    static constexpr uint8_t SBUS_FOOTER = 0x00;
+    static constexpr size_t SBUS_FRAME_LENGTH = 25;
     static constexpr uint32_t SBUS_RX_BUF_NUM = 50;
     static constexpr int32_t RC_CH_VALUE_OFFSET = 1024;
     int32_t channel[16] = {};
@@ -7,11 +7,6 @@
 #include "MultiMedia/LED.h"
 
 void TaskLED() {
-    static uint16_t cnt = 0;
-    cnt++;
-    if(cnt > 1000) {
-        cnt = 0;
-        LED::Toggle();
-    }
+    LED::Toggle();
 }
-TASK_EXPORT(TaskLED);
+TASK_EXPORT_PERIODIC(TaskLED, 1000, 0, Task_Priority_e::Low, 0);
@@ -108,12 +108,14 @@ auto chassis = POV_ChassisBuilder<PlanarOdom>( \
 #include "FineWarden/FineSerial.hpp"
 
 FineSerial fineSerial;
-UARTBuffer<5, 200> uart5Buffer([](uint8_t* data, size_t length) {
+UARTStream<5, 512> uart5Stream;
+FrameExtractor<FineSerial::FRAME_MAX_LENGTH> fineSerialExtractor(FineSerial::FrameFormat(), [](uint8_t* data, size_t length) {
     fineSerial.Decode(data, length);
 });
 
 RadioMaster_Zorro remote;
-UARTBuffer<3, 200> uart3Buffer([](uint8_t* data, size_t length) {
+UARTStream<3, 128> uart3Stream;
+FrameExtractor<25> remoteExtractor(RadioMaster_Zorro::FrameFormat(), [](uint8_t* data, size_t length) {
     remote.Decode(data, length);
 });
 
@@ -128,6 +130,9 @@ UARTBuffer<3, 200> uart3Buffer([](uint8_t* data, size_t length) {
 void TaskPOVChassis() {
     constexpr float SPEED_LIMIT = 2.0f;
 
+    fineSerialExtractor.Poll(uart5Stream);
+    remoteExtractor.Poll(uart3Stream);
+
      if(remote.GetInfo().sC == RemoteControl::SWITCH_STATE_E::UP_POS) {
          std::array<float, 3> targetV = {
              remote.GetInfo().rightCol * SPEED_LIMIT,
@@ -7,10 +7,11 @@
 #include "ProjectConfig.h"
 #include "DeviceBase.h"
 #include "Scheduler.h"
+#include "Profiler/CycleCounter.hpp"
 
-
-#include "FreeRTOS.h"
-#include "task.h"
+#ifdef WITH_PROFILER
+#include "Profiler/Profiler.hpp"
+#endif
 
 /**
  * @brief 用户初始化
@@ -37,9 +38,13 @@ void Loop() {
 #endif
 
 void MainRTLoop() {
+    uint32_t start = CycleCounter<>::Now();
     HAL_IWDG_Refresh(&hiwdg);
     DeviceBase::DevicesHandle();
-    FineMoteScheduler();
+    FineMoteScheduler(start);
+#ifdef WITH_PROFILER
+    Profiler<>::GetInstance().RecordLoop(start);
+#endif
 }
 
 /*****  不要修改以下代码 *****/
@@ -70,4 +70,11 @@
 
 // #define WITH_POV_EXAMPLE
 
+/**
+ * WITH_PROFILER 记录各设备Handle()与各TASK_EXPORT任务的执行周期数，以及主循环的超时次数
+ * PROFILER_REPORT_UART 若定义，则通过对应编号的UART周期性发送统计帧
+ */
+// #define WITH_PROFILER
+// #define PROFILER_REPORT_UART 5
+
 #endif
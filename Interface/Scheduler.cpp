@@ -5,13 +5,163 @@
  ******************************************************************************/
 
 #include "Scheduler.h"
+#include "ProjectConfig.h"
+#include "Profiler/CycleCounter.hpp"
+
+#ifdef WITH_PROFILER
+#include "Profiler/Profiler.hpp"
+#endif
+
+#if defined(__ARMCC_VERSION)
+extern const TaskDescriptor_t Tasks$$Base;
+extern const TaskDescriptor_t Tasks$$Limit;
+#define TASKS_BEGIN (&Tasks$$Base)
+#define TASKS_END (&Tasks$$Limit)
+#else
+// GNU ld 为名称合法的输入段自动生成 __start_ 与 __stop_ 符号
+extern "C" const TaskDescriptor_t __start_Tasks[];
+extern "C" const TaskDescriptor_t __stop_Tasks[];
+#define TASKS_BEGIN (__start_Tasks)
+#define TASKS_END (__stop_Tasks)
+#endif
+
+namespace {
+
+typedef struct {
+    uint32_t nextDue;
+    uint32_t estimate;      // 用于预算判断的执行时间，单位为周期数
+    uint8_t deferrals;      // 连续顺延的次数
+    bool pending;
+} TaskState_t;
+
+TaskState_t states[SCHEDULER_TASK_SLOTS] = {};
+TaskStats_t stats[SCHEDULER_TASK_SLOTS] = {};
+uint32_t tick = 0;
+
+const TaskDescriptor_t *TaskBase() {
+    return TASKS_BEGIN;
+}
+
+size_t ExportedNum() {
+    return TASKS_END - TASKS_BEGIN;
+}
+
+size_t TaskNum() {
+    size_t num = ExportedNum();
+    return num < SCHEDULER_TASK_SLOTS ? num : SCHEDULER_TASK_SLOTS;
+}
+
+void Init() {
+    CycleCounter<>::Init();
+    const TaskDescriptor_t *tasks = TaskBase();
+    for (size_t i = 0; i < TaskNum(); ++i) {
+        uint32_t period = tasks[i].period > 0 ? tasks[i].period : 1;
+        uint32_t first = tick + 1;
+        states[i].nextDue = first + (tasks[i].phase % period + period - first % period) % period;
+        states[i].estimate = CycleCounter<>::FromMicros(tasks[i].budgetUs);
+    }
+}
+
+}
 
 void FineMoteScheduler() {
-    extern const TaskFunc_t Tasks$$Base;
-    extern const TaskFunc_t Tasks$$Limit;
+    FineMoteScheduler(CycleCounter<>::Now());
+}
 
-    const TaskFunc_t *funcPtr;
-    for(funcPtr = &Tasks$$Base; funcPtr < &Tasks$$Limit; funcPtr++) {
-        (*funcPtr)();
+/**
+ * 收集本周期到期或被顺延的任务，按优先级依次执行；可顺延任务的预计执行时间超出本周期剩余预算时顺延到下一周期，
+ * 顺延到下一次到期仍未执行则记为一次错过，连续顺延达到上限后强制执行
+ */
+void FineMoteScheduler(uint32_t tickStart) {
+    static bool initialized = false;
+    if (!initialized) {
+        Init();
+        initialized = true;
     }
+
+    static const uint32_t tickBudget = CycleCounter<>::FromMicros(SCHEDULER_TICK_BUDGET_US);
+    const TaskDescriptor_t *tasks = TaskBase();
+    const size_t taskNum = TaskNum();
+
+    tick++;
+
+    uint8_t ready[SCHEDULER_TASK_SLOTS];
+    size_t readyNum = 0;
+    for (size_t i = 0; i < taskNum; ++i) {
+        TaskState_t &state = states[i];
+        if (state.nextDue == tick) {
+            if (state.pending) {
+                stats[i].missCount++;
+            }
+            state.pending = true;
+            state.nextDue = tick + (tasks[i].period > 0 ? tasks[i].period : 1);
+        }
+        if (!state.pending) {
+            continue;
+        }
+        // 按优先级插入，同优先级保持导出顺序
+        size_t pos = readyNum++;
+        while (pos > 0 && tasks[ready[pos - 1]].priority > tasks[i].priority) {
+            ready[pos] = ready[pos - 1];
+            pos--;
+        }
+        ready[pos] = i;
+    }
+
+    for (size_t n = 0; n < readyNum; ++n) {
+        const size_t i = ready[n];
+        TaskState_t &state = states[i];
+
+        uint32_t start = CycleCounter<>::Now();
+        if (tasks[i].priority >= Task_Priority_e::Normal && state.deferrals < SCHEDULER_MAX_DEFERRALS) {
+            uint32_t elapsed = start - tickStart;
+            if (elapsed >= tickBudget || state.estimate > tickBudget - elapsed) {
+                stats[i].deferCount++;
+                state.deferrals++;
+                // 实测的估计值只在执行后更新，偶发的一次长耗时会使其一直偏大，顺延时逐次减半
+                if (tasks[i].budgetUs == 0) {
+                    state.estimate /= 2;
+                }
+                continue;
+            }
+        }
+
+        tasks[i].func();
+
+        uint32_t cycles = CycleCounter<>::Now() - start;
+#ifdef WITH_PROFILER
+        Profiler<>::GetInstance().RecordTask(i, start);
+#endif
+        state.pending = false;
+        state.deferrals = 0;
+        if (tasks[i].budgetUs == 0) {
+            state.estimate = cycles;
+        }
+
+        TaskStats_t &stat = stats[i];
+        stat.runCount++;
+        stat.lastUs = CycleCounter<>::ToMicros(cycles);
+        if (stat.lastUs > stat.maxUs) {
+            stat.maxUs = stat.lastUs;
+        }
+        if (tasks[i].budgetUs != 0 && stat.lastUs > tasks[i].budgetUs) {
+            stat.overrunCount++;
+        }
+    }
+}
+
+size_t GetTaskCount() {
+    return TaskNum();
+}
+
+size_t GetTaskOverflow() {
+    return ExportedNum() - TaskNum();
+}
+
+const TaskDescriptor_t *GetTaskDescriptor(size_t index) {
+    return index < TaskNum() ? &TaskBase()[index] : nullptr;
+}
+
+const TaskStats_t *GetTaskStats(size_t index) {
+    return index < TaskNum() ? &stats[index] : nullptr;
 }
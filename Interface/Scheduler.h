@@ -7,9 +7,72 @@
 #ifndef FINEMOTE_SCHEDULER_H
 #define FINEMOTE_SCHEDULER_H
 
+#include <cstddef>
+#include <cstdint>
+
+#define SCHEDULER_TASK_SLOTS 32
+#define SCHEDULER_TICK_BUDGET_US 900
+#define SCHEDULER_MAX_DEFERRALS 8
+
 typedef void (*TaskFunc_t)();
-#define TASK_EXPORT(n) __attribute__((used, section("Tasks"))) const TaskFunc_t __##n = n
+
+/**
+ * Critical 与 High 任务每次到期都会执行；Normal 与 Low 任务在本周期剩余预算不足时顺延到下一周期，
+ * 连续顺延SCHEDULER_MAX_DEFERRALS次后不再判断预算而直接执行
+ */
+enum class Task_Priority_e : uint8_t {
+    Critical = 0,
+    High,
+    Normal,
+    Low,
+};
+
+typedef struct {
+    TaskFunc_t func;
+    const char *name;
+    uint16_t period;        // 执行周期，单位为调度周期(1ms)
+    uint16_t phase;         // 在 tick % period == phase 的周期到期
+    Task_Priority_e priority;
+    uint16_t budgetUs;      // 最坏执行时间，0表示使用实测的上一次执行时间
+} TaskDescriptor_t;
+
+typedef struct {
+    uint32_t runCount;
+    uint32_t deferCount;    // 因预算不足被顺延的次数
+    uint32_t missCount;     // 到下一次到期仍未执行而被丢弃的次数
+    uint32_t overrunCount;  // 实际执行时间超出budgetUs的次数
+    uint32_t lastUs;
+    uint32_t maxUs;
+} TaskStats_t;
+
+/**
+ * 描述符在Tasks段中按数组遍历，显式指定对齐以避免编译器对较大的全局对象额外对齐而在段中留下空隙
+ */
+#define TASK_EXPORT_PERIODIC(n, period, phase, priority, budgetUs) \
+    __attribute__((used, section("Tasks"), aligned(alignof(TaskDescriptor_t)))) \
+    const TaskDescriptor_t __##n = {n, #n, period, phase, priority, budgetUs}
+
+/**
+ * 每周期执行且不可顺延，与原先的TASK_EXPORT相同
+ */
+#define TASK_EXPORT(n) TASK_EXPORT_PERIODIC(n, 1, 0, Task_Priority_e::High, 0)
 
 void FineMoteScheduler();
 
+/**
+ * @param tickStart 本周期开始时刻的周期计数，用于计算周期内剩余预算
+ */
+void FineMoteScheduler(uint32_t tickStart);
+
+size_t GetTaskCount();
+
+/**
+ * 超出SCHEDULER_TASK_SLOTS而不会被调度的任务数量，非零时需增大SCHEDULER_TASK_SLOTS
+ */
+size_t GetTaskOverflow();
+
+const TaskDescriptor_t *GetTaskDescriptor(size_t index);
+
+const TaskStats_t *GetTaskStats(size_t index);
+
 #endif
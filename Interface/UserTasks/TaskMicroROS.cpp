@@ -21,21 +21,16 @@ extern SemaphoreHandle_t microRosTaskSemaphore;
  * This decouples the real-time scheduler from the non-real-time communication logic.
  */
 void TaskMicroROS() {
-    // We will wake up the worker task every 20ms (at a 50Hz rate).
-    // This provides a good balance between responsiveness and system load.
-    static uint32_t counter = 0;
-    if (++counter >= 20) {
-        counter = 0;
-
-        if (microRosTaskSemaphore != NULL) {
-            BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-            // Use the ISR-safe version to give the semaphore.
-            xSemaphoreGiveFromISR(microRosTaskSemaphore, &xHigherPriorityTaskWoken);
-            // If a higher priority task was woken, request a context switch on ISR exit.
-            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-        }
+    if (microRosTaskSemaphore != NULL) {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        // Use the ISR-safe version to give the semaphore.
+        xSemaphoreGiveFromISR(microRosTaskSemaphore, &xHigherPriorityTaskWoken);
+        // If a higher priority task was woken, request a context switch on ISR exit.
+        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
     }
 }
 
 // Export the task to the FineMote scheduler's task list.
-TASK_EXPORT(TaskMicroROS);
\ No newline at end of file
+// The scheduler wakes up the worker task every 20ms (at a 50Hz rate), which
+// provides a good balance between responsiveness and system load.
+TASK_EXPORT_PERIODIC(TaskMicroROS, 20, 0, Task_Priority_e::Low, 20);
\ No newline at end of file
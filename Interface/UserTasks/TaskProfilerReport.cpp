@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#include "ProjectConfig.h"
+
+#if defined(WITH_PROFILER) && defined(PROFILER_REPORT_UART)
+
+#include "Scheduler.h"
+#include "Bus/UART_Base.hpp"
+#include "Profiler/Profiler.hpp"
+
+/**
+ * @brief 每10ms发送一条性能统计帧，依次轮询主循环、各设备与各任务，跳过无记录的条目
+ * @note  帧在定时中断中直接打包到串口的发送缓冲区，发送由UART中断完成，不占用主循环的执行时间
+ */
+void TaskProfilerReport() {
+    constexpr uint32_t ENTRY_COUNT = 1 + PROFILER_DEVICE_SLOTS + PROFILER_TASK_SLOTS;
+
+    static_assert(PROFILER_FRAME_SIZE <= UART_TX_SLOT_SIZE, "Profiler frame exceeds UART TX slot");
+
+    static uint32_t entry = 0;
+
+    auto &uart = UART_Base<PROFILER_REPORT_UART>::GetInstance();
+    uint8_t *frame = uart.AcquireTxBuffer();
+    if (frame == nullptr) {
+        return;
+    }
+
+    auto &profiler = Profiler<>::GetInstance();
+    for (uint32_t i = 0; i < ENTRY_COUNT; ++i) {
+        Profiler_Kind_e kind;
+        uint32_t id;
+        if (entry == 0) {
+            kind = Profiler_Kind_e::Loop;
+            id = 0;
+        } else if (entry <= PROFILER_DEVICE_SLOTS) {
+            kind = Profiler_Kind_e::Device;
+            id = entry - 1;
+        } else {
+            kind = Profiler_Kind_e::Task;
+            id = entry - 1 - PROFILER_DEVICE_SLOTS;
+        }
+        entry = (entry + 1) % ENTRY_COUNT;
+
+        size_t size = profiler.Serialize(kind, id, frame);
+        if (size > 0) {
+            uart.Commit(frame, size);
+            return;
+        }
+    }
+    uart.Release(frame);
+}
+
+TASK_EXPORT_PERIODIC(TaskProfilerReport, 10, 5, Task_Priority_e::Low, 0);
+
+#endif
@@ -20,7 +20,8 @@ static void OnUart5DataReceived(uint8_t* data, size_t size)
     {
         // 将接收到的数据原封不动地发回。
         // 我们通过 UART_Base 的单例模式获取 UART5 的实例，并调用其 Transmit 方法。
-        // Transmit 方法会将数据放入发送队列，框架会在后台自动处理发送。
+        // Transmit 方法会将数据复制到 UART5 的发送缓冲区并放入发送队列，框架会在后台自动处理发送，
+        // 因此 data 所在的接收缓冲区即使被下一帧覆盖也不会影响本次发送。
         UART_Base<5>::GetInstance().Transmit(data, size);
     }
 }
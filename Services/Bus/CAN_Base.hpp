@@ -7,26 +7,117 @@
 #ifndef FINEMOTE_CAN_BASE_HPP
 #define FINEMOTE_CAN_BASE_HPP
 
-#include "etl/map.h"
-#include "etl/queue.h"
+#include <atomic>
+#include <cstring>
+
 #include "BSP_CAN.h"
+#include "CriticalSection.hpp"
+#include "DeviceBase.h"
 
 #define CAN_MAP_SIZE 20
+#define CAN_RX_TABLE_BITS 6
+#define CAN_RX_TABLE_SIZE (1 << CAN_RX_TABLE_BITS)
 #define CAN_TX_QUEUE_SIZE 16
 
+static_assert(CAN_RX_TABLE_SIZE >= 2 * CAN_MAP_SIZE, "CAN_RX_TABLE_SIZE should keep the load factor below 0.5");
+
 /**
  * Todo:
  * 远程帧处理
  */
 
+/**
+ * 发送优先级，同一优先级内按标识符仲裁顺序发送
+ */
+enum class CAN_Priority_e : uint8_t {
+    High = 0,
+    Normal,
+    Low
+};
+
 typedef struct {
     uint8_t DLC;
     uint8_t IDE;
     uint8_t RTR;
     uint32_t addr;
     uint8_t message[8];
+    CAN_Priority_e priority;
 } CAN_Package_t;
 
+typedef struct {
+    uint32_t rxFrames;
+    uint32_t rxUnknown;     // 通过硬件过滤器但没有对应CAN_Agent的帧数
+    uint32_t rxOverrun[2];  // 各接收FIFO的溢出次数，每次溢出至少丢失一帧
+    uint32_t rxLost;        // 丢失的帧数，包括FIFO溢出与读取失败
+    uint8_t rxPeakBatch[2]; // 各接收FIFO单次中断取出的最大帧数，接近FIFO深度(3)时说明中断响应不及时
+    uint32_t bindOverflow;  // 超出CAN_MAP_SIZE而未能注册的CAN_Agent数
+    uint32_t filterOverflow;// 过滤器组用尽后注册的标识符数，此时硬件接收全部帧
+    uint32_t txFrames;
+    uint32_t txReplaced;    // 最新值模式下覆盖尚未发出的旧帧数
+    uint32_t txEvicted;     // 队列满时为新帧让出位置而移除的最新值模式帧数
+    uint32_t txDropped;     // 队列满且无可移除的最新值模式帧时被拒绝的帧数
+    uint8_t txPeakQueue;    // 发送队列的最大长度
+} CAN_Stats_t;
+
+/**
+ * 接收帧的快照
+ */
+typedef struct {
+    uint8_t data[8];
+    uint8_t DLC;
+    uint32_t seq;       // 该标识符收到的帧序号，从1开始
+    uint32_t timestamp; // 收到时的HAL_GetTick()
+} CAN_RxFrame_t;
+
+/**
+ * 接收中断写入、控制周期读取的双缓冲接收槽，读写双方均无需关中断
+ * @note 写者写入未发布的一半后递增序号完成发布；读者复制已发布的一半，期间序号前进两次以上才说明该半已被覆盖，此时重试
+ * @note 读者优先级高于写者时，写者无法在读取期间完成发布，读取不会重试；读者被写者抢占时，写者已结束，重试必然前进
+ */
+class CAN_RxSlot {
+public:
+    void Write(const uint8_t *data, uint8_t DLC, uint32_t timestamp) {
+        uint32_t next = seq + 1;
+        CAN_RxFrame_t &frame = frames[next & 1];
+        memcpy(frame.data, data, DLC);
+        memset(frame.data + DLC, 0, sizeof(frame.data) - DLC);
+        frame.DLC = DLC;
+        frame.seq = next;
+        frame.timestamp = timestamp;
+        std::atomic_signal_fence(std::memory_order_release);
+        seq = next;
+    }
+
+    /**
+     * @return 快照的序号，从未收到帧时为0
+     */
+    uint32_t Read(CAN_RxFrame_t &frame) const {
+        uint32_t begin;
+        do {
+            begin = seq;
+            std::atomic_signal_fence(std::memory_order_acquire);
+            frame = frames[begin & 1];
+            std::atomic_signal_fence(std::memory_order_acquire);
+        } while (seq - begin > 1);
+        return begin;
+    }
+
+    uint32_t GetSeq() const {
+        return seq;
+    }
+
+    /**
+     * 最近一帧的第index字节，单字节读取无需快照
+     */
+    uint8_t operator[](std::size_t index) const {
+        return frames[seq & 1].data[index];
+    }
+
+private:
+    CAN_RxFrame_t frames[2] = {};
+    volatile uint32_t seq = 0;
+};
+
 template<size_t ID>
 class CAN_Base {
 public:
@@ -39,62 +130,253 @@ public:
 
     CAN_Base &operator=(const CAN_Base &) = delete;
 
-    void RxHandle() {
+    /**
+     * 一次中断中取出FIFO内的全部帧，避免多个设备同时应答时FIFO溢出
+     * @param FIFO CAN_RX_FIFO0 or CAN_RX_FIFO1
+     */
+    void RxHandle(uint32_t FIFO = CAN_RX_FIFO0) {
         uint8_t tempBuf[8];
         CAN_RxHeaderTypeDef Header;
+        BSP_CAN<ID> &bsp = BSP_CAN<ID>::GetInstance();
+        uint8_t f = FIFO == CAN_RX_FIFO1 ? 1 : 0;
+        uint8_t batch = 0;
+        uint32_t now = HAL_GetTick();
+
+        while (bsp.GetRxFifoFillLevel(FIFO) > 0) {
+            if (!bsp.Receive(FIFO, &Header, tempBuf)) {
+                stats.rxLost++;
+                break;
+            }
+            batch++;
+
+            CAN_RxSlot *slot = Find(Header.IDE == CAN_ID_EXT ? Header.ExtId | EXT_KEY_FLAG : Header.StdId);
+            if (slot == nullptr) {
+                stats.rxUnknown++;
+                continue;
+            }
+            slot->Write(tempBuf, Header.DLC > 8 ? 8 : Header.DLC, now);
+            stats.rxFrames++;
+        }
 
-        BSP_CAN<ID>::GetInstance().Receive(&Header, tempBuf);
+        if (batch > stats.rxPeakBatch[f]) {
+            stats.rxPeakBatch[f] = batch;
+        }
+    }
 
-        if (Header.IDE == CAN_ID_STD) {
-            memcpy(rxBufferMap[Header.StdId], tempBuf, Header.DLC);
-        } else if (Header.IDE == CAN_ID_EXT) {
-            memcpy(rxBufferMap[Header.ExtId], tempBuf, Header.DLC);
+    void ErrorHandle() {
+        uint32_t error = BSP_CAN<ID>::GetInstance().FetchError();
+        if (error & HAL_CAN_ERROR_RX_FOV0) {
+            stats.rxOverrun[0]++;
+            stats.rxLost++;
+        }
+        if (error & HAL_CAN_ERROR_RX_FOV1) {
+            stats.rxOverrun[1]++;
+            stats.rxLost++;
         }
     }
 
+    /**
+     * 按优先级从发送队列中取帧，填满全部空闲的发送邮箱
+     * @note 在发送完成中断与Transmit()中调用，BSP开启了邮箱的FIFO发送模式，各帧按出队顺序发送
+     */
     void TxHandle() {
-        if (!dataQueue.empty()) {
+        CriticalSection lock;
+        BSP_CAN<ID> &bsp = BSP_CAN<ID>::GetInstance();
+
+        while (txCount > 0 && bsp.GetTxMailboxesFreeLevel() > 0) {
+            const CAN_Package_t &package = txQueue[txCount - 1].package;
             CAN_TxHeaderTypeDef Header;
 
-            if (dataQueue.front().IDE == CAN_ID_STD) {
-                Header.StdId = dataQueue.front().addr;
-            } else if (dataQueue.front().IDE == CAN_ID_EXT) {
-                Header.ExtId = dataQueue.front().addr;
+            Header.StdId = package.IDE == CAN_ID_STD ? package.addr : 0;
+            Header.ExtId = package.IDE == CAN_ID_EXT ? package.addr : 0;
+            Header.DLC = package.DLC;
+            Header.IDE = package.IDE;
+            Header.RTR = package.RTR;
+            Header.TransmitGlobalTime = DISABLE;
+
+            if (!bsp.Transmit(&Header, package.message)) {
+                break;
             }
+            txCount--;
+            stats.txFrames++;
+        }
+    }
 
-            Header.DLC = dataQueue.front().DLC;
-            Header.IDE = dataQueue.front().IDE;
-            Header.RTR = dataQueue.front().RTR;
-            Header.TransmitGlobalTime = DISABLE;
+    /**
+     * 按优先级插入发送队列，优先级与标识符相同的帧保持先后顺序
+     * @return 队列已满且其中没有最新值模式的帧时拒绝该帧并返回false
+     * @note 一次性的帧从不被覆盖或移除；队列已满时移除其中优先级最低的最新值模式帧，该帧在下一周期会重新生成
+     */
+    bool Transmit(const CAN_Package_t &txbuf) {
+        bool accepted = Enqueue(txbuf, false);
+        TxHandle();
+        return accepted;
+    }
 
-            BSP_CAN<ID>::GetInstance().Transmit(&Header, dataQueue.front().message);
+    /**
+     * 最新值模式发送，队列中已有同一标识符的最新值模式帧时原位覆盖其数据，不增加队列长度
+     * @note 用于周期发送的控制指令，总线阻塞时每个标识符最多排队一帧，不会挤占一次性的配置指令
+     */
+    bool TransmitLatest(const CAN_Package_t &txbuf) {
+        bool accepted = Enqueue(txbuf, true);
+        TxHandle();
+        return accepted;
+    }
 
-            dataQueue.pop();
+    /**
+     * 注册接收槽并为该标识符添加硬件过滤器
+     * @param IDE CAN_ID_STD or CAN_ID_EXT
+     * @param FIFO CAN_RX_FIFO0 or CAN_RX_FIFO1，两个FIFO的接收中断可在NVIC中设置不同优先级
+     * @return 超出CAN_MAP_SIZE时注册失败
+     */
+    bool BindRxSlot(CAN_RxSlot *slot, uint32_t addr, uint32_t IDE = CAN_ID_STD, uint32_t FIFO = CAN_RX_FIFO0) {
+        uint32_t key = IDE == CAN_ID_EXT ? addr | EXT_KEY_FLAG : addr;
+        uint32_t index = Hash(key);
+        uint32_t probe = 0;
+        while (rxTable[index].slot != nullptr && rxTable[index].key != key) {
+            index = (index + 1) & (CAN_RX_TABLE_SIZE - 1);
+            probe++;
+        }
+        if (rxTable[index].slot == nullptr) {
+            if (rxCount == CAN_MAP_SIZE) {
+                stats.bindOverflow++;
+                return false;
+            }
+            rxCount++;
+            if (!BSP_CAN<ID>::GetInstance().AddFilter(addr, IDE, FIFO)) {
+                stats.filterOverflow++;
+            }
+        }
+        if (probe > maxProbe) {
+            maxProbe = probe;
+        }
+        rxTable[index].key = key;
+        rxTable[index].slot = slot;
+        return true;
+    }
+
+    const CAN_Stats_t &GetStats() const {
+        return stats;
+    }
+
+private:
+    static constexpr uint32_t EXT_KEY_FLAG = 0x80000000;
+
+    typedef struct {
+        uint32_t key;
+        CAN_RxSlot *slot;
+    } RxEntry_t;
+
+    typedef struct {
+        uint32_t key;
+        bool latest;
+        CAN_Package_t package;
+    } TxEntry_t;
+
+    /**
+     * 发送排序键，越小越先发送：优先级占最高2位，其后按总线仲裁顺序排列标识符
+     * @note 标准帧与基本标识符相同的扩展帧相比，标准帧的IDE位为显性，先赢得仲裁
+     */
+    static uint32_t TxKey(const CAN_Package_t &package) {
+        uint32_t arbitration;
+        if (package.IDE == CAN_ID_EXT) {
+            arbitration = ((package.addr >> 18 & 0x7FF) << 19) | (1u << 18) | (package.addr & 0x3FFFF);
         } else {
-            isTxComplete = true;
+            arbitration = (package.addr & 0x7FF) << 19;
         }
+        return (static_cast<uint32_t>(package.priority) << 30) | arbitration;
     }
 
-    bool Transmit(CAN_Package_t &txbuf) {
-        if (dataQueue.full()) {
-            dataQueue.pop();
+    /**
+     * @param latest 为true时覆盖队列中同一标识符且同为latest模式的帧
+     * @note 队列满时只移除latest模式的帧：新帧为一次性帧时移除其中优先级最低的一帧，
+     *       新帧为latest模式时只移除优先级低于新帧的一帧，否则拒绝新帧
+     */
+    bool Enqueue(const CAN_Package_t &txbuf, bool latest) {
+        CriticalSection lock;
+        uint32_t key = TxKey(txbuf);
+
+        if (latest) {
+            for (size_t i = 0; i < txCount; ++i) {
+                const CAN_Package_t &queued = txQueue[i].package;
+                if (!txQueue[i].latest || queued.addr != txbuf.addr || queued.IDE != txbuf.IDE ||
+                    queued.RTR != txbuf.RTR) {
+                    continue;
+                }
+                stats.txReplaced++;
+                if (txQueue[i].key == key) {
+                    txQueue[i].package = txbuf;
+                    return true;
+                }
+                // 优先级改变，移除后按新的key重新插入
+                Remove(i);
+                break;
+            }
+        }
+        if (txCount == CAN_TX_QUEUE_SIZE) {
+            // 队列按key降序排列，第一个latest模式的帧即其中优先级最低的
+            size_t victim = 0;
+            while (victim < txCount && !txQueue[victim].latest) {
+                victim++;
+            }
+            if (victim == txCount || (latest && txQueue[victim].key <= key)) {
+                stats.txDropped++;
+                return false;
+            }
+            Remove(victim);
+            stats.txEvicted++;
+        }
+
+        size_t pos = 0;
+        while (pos < txCount && txQueue[pos].key > key) {
+            pos++;
+        }
+        for (size_t i = txCount; i > pos; --i) {
+            txQueue[i] = txQueue[i - 1];
         }
-        dataQueue.push(txbuf);
-        if (isTxComplete == true) {
-            TxHandle();
-            isTxComplete = false;
+        txQueue[pos] = {key, latest, txbuf};
+        txCount++;
+        if (txCount > stats.txPeakQueue) {
+            stats.txPeakQueue = txCount;
         }
         return true;
     }
 
-    void BindRxBuffer(uint8_t *buffer, uint32_t addr) {
-        rxBufferMap[addr] = buffer;
+    void Remove(size_t index) {
+        for (size_t i = index + 1; i < txCount; ++i) {
+            txQueue[i - 1] = txQueue[i];
+        }
+        txCount--;
     }
 
-private:
-    etl::map<uint32_t, uint8_t *, CAN_MAP_SIZE> rxBufferMap;
-    etl::queue<CAN_Package_t,CAN_TX_QUEUE_SIZE> dataQueue;
-    bool isTxComplete = true;
+    static uint32_t Hash(uint32_t key) {
+        return (key * 2654435761u) >> (32 - CAN_RX_TABLE_BITS);
+    }
+
+    /**
+     * 线性探测查找，探测长度不超过注册时记录的最大值，未注册的标识符不会插入表中
+     */
+    CAN_RxSlot *Find(uint32_t key) const {
+        uint32_t index = Hash(key);
+        for (uint32_t probe = 0; probe <= maxProbe; ++probe) {
+            const RxEntry_t &entry = rxTable[index];
+            if (entry.slot == nullptr) {
+                return nullptr;
+            }
+            if (entry.key == key) {
+                return entry.slot;
+            }
+            index = (index + 1) & (CAN_RX_TABLE_SIZE - 1);
+        }
+        return nullptr;
+    }
+
+    RxEntry_t rxTable[CAN_RX_TABLE_SIZE] = {};
+    uint32_t rxCount = 0;
+    uint32_t maxProbe = 0;
+    CAN_Stats_t stats = {};
+    TxEntry_t txQueue[CAN_TX_QUEUE_SIZE] = {};   // 按key降序排列，末尾为下一帧
+    size_t txCount = 0;
 
     CAN_Base() {
         BSP_CAN<ID>::GetInstance();
@@ -104,15 +386,24 @@ private:
 template<size_t ID>
 class CAN_Agent {
 public:
-    explicit CAN_Agent(uint32_t addr) : addr(addr) {
+    /**
+     * @param addr 接收帧的标识符
+     * @param IDE 接收帧的类型，CAN_ID_STD or CAN_ID_EXT，标识符超出11位时按扩展帧处理
+     * @param FIFO 接收FIFO，电机反馈等控制相关的帧使用CAN_RX_FIFO0，遥测等低优先级的帧使用CAN_RX_FIFO1
+     */
+    explicit CAN_Agent(uint32_t addr, uint32_t IDE = CAN_ID_STD, uint32_t FIFO = CAN_RX_FIFO0) : addr(addr) {
         static_assert(ID > 0 && ID <= CAN_BUS_MAXIMUM_COUNT && BSP_CANList[ID] != nullptr, "Using illegal CAN BUS");
-        CAN_Base<ID>::GetInstance().BindRxBuffer(rxbuf, addr);
+        CAN_Base<ID>::GetInstance().BindRxSlot(&rxSlot, addr, addr > 0x7FF ? CAN_ID_EXT : IDE, FIFO);
     }
 
     void SetDLC(uint8_t _DLC) {
         txbuf.DLC = _DLC;
     }
 
+    void SetPriority(CAN_Priority_e priority) {
+        txbuf.priority = priority;
+    }
+
     /**
      * @brief CAN发送队列装填
      * @param _addr
@@ -128,19 +419,137 @@ public:
         CAN_Base<ID>::GetInstance().Transmit(txbuf);
     }
 
+    /**
+     * @brief 最新值模式发送，尚未发出的同一标识符的上一帧会被本帧覆盖
+     * @param _addr
+     * @param config IDE | RTR
+     * @note 用于每次Handle都会重新生成的控制指令
+     */
+    void TransmitLatest(uint32_t _addr, uint8_t config = CAN_ID_STD | CAN_RTR_DATA) {
+        txbuf.addr = _addr;
+        txbuf.IDE = config & CAN_ID_EXT;
+        txbuf.RTR = config & CAN_RTR_REMOTE;
+
+        CAN_Base<ID>::GetInstance().TransmitLatest(txbuf);
+    }
+
     uint8_t &operator[](std::size_t index) {
         return txbuf.message[index];
     }
 
     uint8_t operator[](std::size_t index) const {
-        return rxbuf[index];
+        return rxSlot[index];
+    }
+
+    /**
+     * 读取最近一帧的一致快照，可在任意优先级的中断中调用
+     * @return 自上次调用后收到的帧数，为0时frame仍为最近一帧，从未收到帧时数据全为0
+     */
+    uint32_t Read(CAN_RxFrame_t &frame) {
+        uint32_t seq = rxSlot.Read(frame);
+        uint32_t fresh = seq - readSeq;
+        readSeq = seq;
+        return fresh;
+    }
+
+    /**
+     * @return 距最近一帧的毫秒数，从未收到帧时返回UINT32_MAX
+     */
+    uint32_t GetRxAge() const {
+        CAN_RxFrame_t frame;
+        if (rxSlot.Read(frame) == 0) {
+            return UINT32_MAX;
+        }
+        return HAL_GetTick() - frame.timestamp;
+    }
+
+    /**
+     * @return 该标识符收到的总帧数
+     */
+    uint32_t GetRxCount() const {
+        return rxSlot.GetSeq();
     }
 
     uint32_t addr;
-    uint8_t rxbuf[8] = {0};
 
 private:
-    CAN_Package_t txbuf = {8};
+    CAN_RxSlot rxSlot;
+    uint32_t readSeq = 0;
+    CAN_Package_t txbuf = {8, CAN_ID_STD, CAN_RTR_DATA, 0, {0}, CAN_Priority_e::Normal};
+};
+
+#define CAN_GROUP_SLOT_COUNT 4
+
+/**
+ * 多电机共用一帧的控制指令，如LK/RMD的0x280转矩指令与DJI电调的0x200/0x1FF指令
+ * 每个电机占用一个2字节的槽位，所有加入的电机写入后立即发出
+ * @note 分组本身是分频系数为1的设备，在Handle中发出本周期已写入但未发出的数据；分组先于成员电机构造，
+ *       同一周期内在成员之后执行，因此某个电机停止写入(如被禁用或分频不同)时，其余电机的指令仍在本周期发出；
+ *       每帧中未写入的槽位为0
+ * @note 加入同一分组的电机应使用相同的分频系数与相位，以便在同一控制周期内写入
+ */
+template<size_t ID>
+class CAN_GroupAgent : public DeviceBase {
+public:
+    /**
+     * @param addr 分组指令的标识符
+     * @param bigEndian 槽位数据的字节序，LK/RMD为小端，DJI为大端
+     */
+    explicit CAN_GroupAgent(uint32_t addr, bool bigEndian = false) : bigEndian(bigEndian) {
+        static_assert(ID > 0 && ID <= CAN_BUS_MAXIMUM_COUNT && BSP_CANList[ID] != nullptr, "Using illegal CAN BUS");
+        txbuf.addr = addr;
+    }
+
+    void Handle() final {
+        Flush();
+    }
+
+    /**
+     * @param slot 槽位编号，从0开始，对应帧中第2*slot字节
+     * @return 槽位超出CAN_GROUP_SLOT_COUNT时加入失败，调用者应改用单独的指令帧
+     */
+    bool Join(uint32_t slot) {
+        if (slot >= CAN_GROUP_SLOT_COUNT) {
+            return false;
+        }
+        joinedMask |= 1u << slot;
+        return true;
+    }
+
+    void Write(uint8_t slot, int16_t value) {
+        if (slot >= CAN_GROUP_SLOT_COUNT) {
+            return;
+        }
+        uint8_t bit = 1u << slot;
+        if (writtenMask & bit) {
+            Flush();
+        }
+
+        uint16_t raw = static_cast<uint16_t>(value);
+        txbuf.message[2 * slot + (bigEndian ? 1 : 0)] = raw & 0xFF;
+        txbuf.message[2 * slot + (bigEndian ? 0 : 1)] = raw >> 8;
+        writtenMask |= bit;
+
+        if ((writtenMask & joinedMask) == joinedMask) {
+            Flush();
+        }
+    }
+
+    void Flush() {
+        if (writtenMask == 0) {
+            return;
+        }
+        CAN_Base<ID>::GetInstance().TransmitLatest(txbuf);
+        // 清零已发出的数据，本轮未写入的槽位在下一帧中为0，停止写入的电机不会持续收到其最后的指令
+        memset(txbuf.message, 0, sizeof(txbuf.message));
+        writtenMask = 0;
+    }
+
+private:
+    CAN_Package_t txbuf = {8, CAN_ID_STD, CAN_RTR_DATA, 0, {0}, CAN_Priority_e::Normal};
+    bool bigEndian;
+    uint8_t joinedMask = 0;
+    uint8_t writtenMask = 0;
 };
 
 template<typename T = decltype(BSP_CANList[0])>
@@ -151,9 +560,14 @@ public:
         TxCompleteImpl<maxID>(hcan);
     }
 
-    static void OnRxComplete(T hcan) {
+    static void OnRxComplete(T hcan, uint32_t FIFO = CAN_RX_FIFO0) {
+        constexpr size_t maxID = sizeof(BSP_CANList) / sizeof(BSP_CANList[0]) - 1;
+        RxCompleteImpl<maxID>(hcan, FIFO);
+    }
+
+    static void OnError(T hcan) {
         constexpr size_t maxID = sizeof(BSP_CANList) / sizeof(BSP_CANList[0]) - 1;
-        RxCompleteImpl<maxID>(hcan);
+        ErrorImpl<maxID>(hcan);
     }
 
 private:
@@ -171,15 +585,28 @@ private:
     }
 
     template<size_t ID>
-    static void RxCompleteImpl(T hcan) {
+    static void RxCompleteImpl(T hcan, uint32_t FIFO) {
+        if constexpr (BSP_CANList[ID] != nullptr) {
+            if (hcan == BSP_CANList[ID]) {
+                CAN_Base<ID>::GetInstance().RxHandle(FIFO);
+                return;
+            }
+        }
+        if constexpr (ID > 1) {
+            RxCompleteImpl<ID - 1>(hcan, FIFO);
+        }
+    }
+
+    template<size_t ID>
+    static void ErrorImpl(T hcan) {
         if constexpr (BSP_CANList[ID] != nullptr) {
             if (hcan == BSP_CANList[ID]) {
-                CAN_Base<ID>::GetInstance().RxHandle();
+                CAN_Base<ID>::GetInstance().ErrorHandle();
                 return;
             }
         }
         if constexpr (ID > 1) {
-            RxCompleteImpl<ID - 1>(hcan);
+            ErrorImpl<ID - 1>(hcan);
         }
     }
 };
@@ -0,0 +1,450 @@
+/*******************************************************************************
+ * Copyright (c) 2024.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_I2C_BASE_HPP
+#define FINEMOTE_I2C_BASE_HPP
+
+#include <cstring>
+#include <functional>
+
+#include "DeviceBase.h"
+#include "BSP_I2C.h"
+#include "CriticalSection.hpp"
+
+#define I2C_TRANSACTION_QUEUE_SIZE 16   // 每条总线可排队的事务数
+#define I2C_INLINE_DATA_SIZE 8          // 写事务在队列中保存的数据长度，更长的数据直接引用调用者的缓冲区
+#define I2C_TIMEOUT_MARGIN_US 500       // 超时窗口在传输时间之外为时钟延展与中断延迟预留的余量
+
+enum class I2C_Op_e : uint8_t {
+    Read,
+    Write,
+    MemRead,
+    MemWrite,
+    Delay,
+};
+
+/**
+ * 一次寄存器连续读取，从reg开始读取size字节到data
+ */
+typedef struct {
+    uint8_t reg;
+    uint8_t *data;
+    uint16_t size;
+} I2C_BurstRead_t;
+
+typedef struct {
+    uint32_t transactions;  // 成功完成的传输数
+    uint32_t errors;        // 失败的传输数，包括从机无应答、仲裁丢失、启动失败与超时
+    uint32_t timeouts;
+    uint32_t recoveries;    // 总线恢复次数
+    uint32_t lockups;       // 恢复后总线仍被占用、未调用HAL直接失败的事务数
+    uint32_t dropped;       // 因队列已满或上一批次未完成而被拒绝的请求数
+    uint32_t peakQueue;     // 同时排队的最大事务数
+} I2C_Stats_t;
+
+template<uint8_t ID>
+class I2C_Agent;
+
+/**
+ * I2C总线的事务队列，队列为定长环形数组，入队与传输过程中均不分配内存
+ * @note 传输在完成中断中直接启动下一条，Handle只负责检查超时与延时事务；超时后恢复总线并以失败结束该事务
+ * @note 批量事务连续入队，其中一条失败时丢弃同批次的剩余事务
+ * @note 临界区内只维护队列与序号，HAL启动函数与总线恢复均在临界区外调用，二者在总线被占用时会忙等
+ */
+template<uint8_t ID>
+class I2C_Base : public DeviceBase {
+public:
+    static I2C_Base &GetInstance() {
+        static I2C_Base instance;
+        return instance;
+    }
+
+    I2C_Base(const I2C_Base &) = delete;
+
+    I2C_Base &operator=(const I2C_Base &) = delete;
+
+    void Handle() final {
+        uint32_t seq;
+        bool ok;
+        {
+            CriticalSection cs;
+            if (!busy || static_cast<int32_t>(HAL_GetTick() - deadlineTick) < 0) {
+                return;
+            }
+            ok = queue[head].op == I2C_Op_e::Delay;
+            if (!ok) {
+                // 更新序号使超时传输迟到的完成回调被忽略，总线在恢复期间仍视为忙
+                stats.timeouts++;
+                currentSeq++;
+            }
+            seq = currentSeq;
+        }
+        if (!ok) {
+            Recover();
+        }
+        Finish(seq, ok);
+    }
+
+    /**
+     * 在HAL的传输完成或错误回调中调用
+     */
+    void CompleteHandle(bool ok) {
+        uint32_t seq;
+        {
+            CriticalSection cs;
+            seq = currentSeq;
+        }
+        Finish(seq, ok);
+    }
+
+    const I2C_Stats_t &GetStats() const {
+        return stats;
+    }
+
+    size_t GetQueueSize() const {
+        return count;
+    }
+
+private:
+    typedef struct {
+        I2C_Op_e op;
+        bool notify;            // 完成后回调，批量事务只有最后一条为true
+        uint8_t addr;
+        uint8_t reg;
+        uint16_t size;          // 延时事务中为毫秒数
+        uint16_t timeoutMs;     // 0表示按传输长度与时钟频率计算
+        bool batch;             // 属于MemReadBatch的批次，完成时解除代理的批次占用
+        uint8_t *buffer;        // 为nullptr时使用data
+        uint8_t data[I2C_INLINE_DATA_SIZE];
+        I2C_Agent<ID> *agent;
+    } Transaction_t;
+
+    I2C_Base() {
+        static_assert((ID > 0) && (ID <= I2C_BUS_MAXIMUM_COUNT), "Using illegal I2C BUS");
+        BSP_I2C<ID>::GetInstance();
+    }
+
+    /**
+     * 将n条事务连续入队，fill(transaction, i)填写第i条
+     * @return 空间不足时全部丢弃并返回false
+     */
+    template<typename F>
+    bool Enqueue(size_t n, F fill) {
+        uint32_t seq;
+        Transaction_t *next = nullptr;
+        {
+            CriticalSection cs;
+            if (n == 0 || count + n > I2C_TRANSACTION_QUEUE_SIZE) {
+                stats.dropped++;
+                return false;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                Transaction_t &t = queue[(head + count + i) % I2C_TRANSACTION_QUEUE_SIZE];
+                t.buffer = nullptr;
+                t.notify = false;
+                t.batch = false;
+                fill(t, i);
+            }
+            count += n;
+            if (count > stats.peakQueue) {
+                stats.peakQueue = count;
+            }
+            if (!busy) {
+                next = Claim();
+            }
+            seq = currentSeq;
+        }
+        if (next != nullptr && !Launch(*next)) {
+            Finish(seq, false);
+        }
+        return true;
+    }
+
+    /**
+     * 占用队首事务并开始计算超时，需在临界区中且总线空闲时调用；占用期间队首不会出队，可在临界区外访问
+     * @return 需要启动传输的事务，由调用者在临界区外调用Launch；队列为空或为延时事务时返回nullptr
+     */
+    Transaction_t *Claim() {
+        if (count == 0) {
+            return nullptr;
+        }
+        Transaction_t &t = queue[head];
+        busy = true;
+        currentSeq++;
+        if (t.op == I2C_Op_e::Delay) {
+            deadlineTick = HAL_GetTick() + t.size;
+            return nullptr;
+        }
+        deadlineTick = HAL_GetTick() + TimeoutTicks(t);
+        return &t;
+    }
+
+    /**
+     * 启动已占用的事务，总线被占用时先恢复；恢复后仍被占用则不调用HAL，避免在启动函数中忙等
+     * @return 启动失败时返回false，由调用者以失败结束该事务
+     */
+    bool Launch(Transaction_t &t) {
+        BSP_I2C<ID> &bsp = BSP_I2C<ID>::GetInstance();
+        if (bsp.IsBusBusy() && !bsp.WaitBusIdle()) {
+            Recover();
+            if (bsp.IsBusBusy()) {
+                CriticalSection cs;
+                stats.lockups++;
+                return false;
+            }
+        }
+        uint8_t *data = t.buffer != nullptr ? t.buffer : t.data;
+        bool started = false;
+        switch (t.op) {
+            case I2C_Op_e::Read:
+                started = bsp.Receive(t.addr, data, t.size);
+                break;
+            case I2C_Op_e::Write:
+                started = bsp.Transmit(t.addr, data, t.size);
+                break;
+            case I2C_Op_e::MemRead:
+                started = bsp.MemRead(t.addr, t.reg, data, t.size);
+                break;
+            case I2C_Op_e::MemWrite:
+                started = bsp.MemWrite(t.addr, t.reg, data, t.size);
+                break;
+            default:
+                break;
+        }
+        return started;
+    }
+
+    /**
+     * 以ok结束序号为seq的事务并启动下一条；序号不符说明该事务已由其他上下文结束
+     */
+    void Finish(uint32_t seq, bool ok) {
+        while (true) {
+            Transaction_t done;
+            Transaction_t *next;
+            {
+                CriticalSection cs;
+                if (!busy || seq != currentSeq) {
+                    return;
+                }
+                busy = false;
+                done = queue[head];
+                if (done.op != I2C_Op_e::Delay) {
+                    ok ? stats.transactions++ : stats.errors++;
+                }
+                Pop();
+                while (!ok && !done.notify && count > 0) {
+                    done = queue[head];
+                    Pop();
+                }
+                next = Claim();
+                seq = currentSeq;
+            }
+            bool started = next == nullptr || Launch(*next);
+            if (done.notify && done.agent != nullptr) {
+                bool isRead = done.op == I2C_Op_e::Read || done.op == I2C_Op_e::MemRead;
+                done.agent->Complete(done.reg, isRead ? done.buffer : nullptr, done.size, ok, done.batch);
+            }
+            if (started) {
+                return;
+            }
+            ok = false;
+        }
+    }
+
+    void Pop() {
+        head = (head + 1) % I2C_TRANSACTION_QUEUE_SIZE;
+        count--;
+    }
+
+    /**
+     * 只由占用总线的一方在临界区外调用
+     */
+    void Recover() {
+        BSP_I2C<ID>::GetInstance().Recover();
+        CriticalSection cs;
+        stats.recoveries++;
+    }
+
+    /**
+     * 每字节9个时钟，加上地址与寄存器地址字节；超时窗口向上取整到毫秒后再留一个Handle周期
+     */
+    uint32_t TimeoutTicks(const Transaction_t &t) {
+        if (t.timeoutMs > 0) {
+            return t.timeoutMs + 1;
+        }
+        uint32_t bytes = t.size + 1;
+        if (t.op == I2C_Op_e::MemRead) {
+            bytes += 2;
+        } else if (t.op == I2C_Op_e::MemWrite) {
+            bytes += 1;
+        }
+        uint32_t windowUs = static_cast<uint32_t>(static_cast<uint64_t>(bytes) * 9 * 1000000u /
+                                                  BSP_I2C<ID>::GetInstance().GetClockSpeed()) + I2C_TIMEOUT_MARGIN_US;
+        return (windowUs + 999) / 1000 + 1;
+    }
+
+    Transaction_t queue[I2C_TRANSACTION_QUEUE_SIZE] = {};
+    size_t head = 0;
+    size_t count = 0;
+    bool busy = false;
+    uint32_t currentSeq = 0;
+    uint32_t deadlineTick = 0;
+    I2C_Stats_t stats = {};
+
+    friend class I2C_Agent<ID>;
+};
+
+/**
+ * I2C从机代理，请求均为非阻塞，入队失败时返回false
+ * @note 回调在传输完成中断或设备Handle中执行，参数为寄存器地址、读取的数据（写事务为nullptr）、长度与是否成功
+ */
+template<uint8_t ID>
+class I2C_Agent {
+public:
+    using Callback_t = std::function<void(uint8_t reg, uint8_t *data, uint16_t size, bool ok)>;
+
+    /**
+     * @param _addr 7位地址，不含读写位
+     */
+    explicit I2C_Agent(uint8_t _addr, Callback_t _callback = nullptr) : addr(_addr), callback(_callback) {
+        I2C_Base<ID>::GetInstance();
+    }
+
+    bool Read(uint8_t *data, uint16_t size) {
+        return Request(I2C_Op_e::Read, 0, data, size);
+    }
+
+    /**
+     * 不超过I2C_INLINE_DATA_SIZE的数据复制到队列中，返回后即可复用；更长的数据需保证在回调前有效
+     */
+    bool Write(const uint8_t *data, uint16_t size) {
+        return Request(I2C_Op_e::Write, 0, const_cast<uint8_t *>(data), size);
+    }
+
+    bool MemRead(uint8_t reg, uint8_t *data, uint16_t size) {
+        return Request(I2C_Op_e::MemRead, reg, data, size);
+    }
+
+    /**
+     * 数据的生命周期要求与Write相同
+     */
+    bool MemWrite(uint8_t reg, const uint8_t *data, uint16_t size) {
+        return Request(I2C_Op_e::MemWrite, reg, const_cast<uint8_t *>(data), size);
+    }
+
+    /**
+     * 多段寄存器连续读取作为一个批次连续入队，在总线上背靠背完成，全部完成或任一段失败后只回调一次，参数为最后一段
+     * @return 本代理的上一批次尚未完成时拒绝，高频轮询在总线跟不上时丢弃新请求而不是积压过期的读取
+     */
+    bool MemReadBatch(const I2C_BurstRead_t *reads, size_t count) {
+        I2C_Base<ID> &bus = I2C_Base<ID>::GetInstance();
+        {
+            CriticalSection cs;
+            if (batchPending) {
+                bus.stats.dropped++;
+                return false;
+            }
+            batchPending = true;
+        }
+        bool queued = bus.Enqueue(count, [&](typename I2C_Base<ID>::Transaction_t &t, size_t i) {
+            Fill(t, I2C_Op_e::MemRead, reads[i].reg, reads[i].data, reads[i].size);
+            t.notify = i == count - 1;
+            t.batch = true;
+        });
+        if (!queued) {
+            batchPending = false;
+        }
+        return queued;
+    }
+
+    /**
+     * 总线静默ms毫秒，用于等待器件复位、写入等内部操作完成
+     */
+    bool Delay(uint16_t ms) {
+        return I2C_Base<ID>::GetInstance().Enqueue(1, [&](typename I2C_Base<ID>::Transaction_t &t, size_t) {
+            t.op = I2C_Op_e::Delay;
+            t.addr = addr;
+            t.size = ms;
+            t.agent = this;
+        });
+    }
+
+    /**
+     * 指定本代理事务的超时时间，用于有较长时钟延展的器件；0表示按传输长度自动计算
+     */
+    void SetTimeout(uint16_t ms) {
+        timeoutMs = ms;
+    }
+
+    bool IsBatchPending() const {
+        return batchPending;
+    }
+
+private:
+    friend class I2C_Base<ID>;
+
+    bool Request(I2C_Op_e op, uint8_t reg, uint8_t *data, uint16_t size) {
+        if (size == 0) {
+            return false;
+        }
+        return I2C_Base<ID>::GetInstance().Enqueue(1, [&](typename I2C_Base<ID>::Transaction_t &t, size_t) {
+            Fill(t, op, reg, data, size);
+            t.notify = true;
+        });
+    }
+
+    void Fill(typename I2C_Base<ID>::Transaction_t &t, I2C_Op_e op, uint8_t reg, uint8_t *data, uint16_t size) {
+        t.op = op;
+        t.addr = addr;
+        t.reg = reg;
+        t.size = size;
+        t.timeoutMs = timeoutMs;
+        t.agent = this;
+        bool isWrite = op == I2C_Op_e::Write || op == I2C_Op_e::MemWrite;
+        if (isWrite && size <= I2C_INLINE_DATA_SIZE) {
+            memcpy(t.data, data, size);
+        } else {
+            t.buffer = data;
+        }
+    }
+
+    void Complete(uint8_t reg, uint8_t *data, uint16_t size, bool ok, bool batch) {
+        if (batch) {
+            batchPending = false;
+        }
+        if (callback) {
+            callback(reg, data, size, ok);
+        }
+    }
+
+    uint8_t addr;
+    uint16_t timeoutMs = 0;
+    volatile bool batchPending = false;
+    Callback_t callback;
+};
+
+template<typename T = decltype(BSP_I2CList[0])>
+class FineMoteAux_I2C {
+public:
+    static void OnComplete(T &instance, bool ok) {
+        CompleteImpl<I2C_BUS_MAXIMUM_COUNT>(instance, ok);
+    }
+
+    template<size_t ID>
+    static void CompleteImpl(T &instance, bool ok) {
+        if constexpr (BSP_I2CList[ID] != nullptr) {
+            if (instance == BSP_I2CList[ID]) {
+                I2C_Base<ID>::GetInstance().CompleteHandle(ok);
+                return;
+            }
+        }
+        if constexpr (ID > 1) {
+            CompleteImpl<ID - 1>(instance, ok);
+        }
+    }
+};
+
+#endif
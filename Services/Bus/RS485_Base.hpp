@@ -7,18 +7,47 @@
 #ifndef FINEMOTE_RS485_BASE_HPP
 #define FINEMOTE_RS485_BASE_HPP
 
-#include "etl/map.h"
 #include "DeviceBase.h"
 #include "UART_Base.hpp"
 #include "BSP_RS485.h"
+#include "CriticalSection.hpp"
+#include "CycleCounter.hpp"
 
-#define RS485_RX_BUFFER_LENGTH 30
+#define RS485_RX_BUFFER_LENGTH 64
 #define RS485_AGENT_SIZE 16
-#define RS485_RX_MAX_MS 5
+#define RS485_CHAR_BITS 10          // 8N1，每字节10位
+#define RS485_TURNAROUND_US 300     // 从机处理与总线换向的余量
+
+enum class RS485_Priority_e : uint8_t {
+    High = 0,
+    Normal,
+    Low,
+};
+
+typedef struct {
+    uint32_t transactions;  // 已发出的请求数
+    uint32_t responses;
+    uint32_t timeouts;
+    uint32_t replaced;      // 排队期间被同一从机的新请求覆盖的次数
+    uint32_t lastLatencyUs; // 发送完成到收到应答的时间
+    uint32_t maxLatencyUs;
+} RS485_Stats_t;
+
+typedef struct {
+    uint32_t turnarounds;       // 收到应答后立即发出下一条请求的次数
+    uint32_t lastTurnaroundUs;  // 收到应答到下一条请求提交发送的软件耗时
+    uint32_t maxTurnaroundUs;
+} RS485_BusStats_t;
 
 template<size_t ID>
 class RS485_Agent;
 
+/**
+ * 多从机RS485总线的事务调度器
+ * @note 每个从机（RS485_Agent）至多挂起一条请求，新请求覆盖未发出的旧请求；总线空闲时按优先级选择，同优先级轮询
+ * @note 事务为 发送请求 -> 发送完成(TC)中断中切换为接收 -> 收到应答或超时，应答在中断中直接解析并立即切换为发送、
+ *       提交下一条请求，收发转换不等待控制周期；超时窗口由波特率与从机应答长度计算，在Handle中按毫秒检查
+ */
 template<size_t ID>
 class RS485_Base : public DeviceBase {
 public:
@@ -28,87 +57,239 @@ public:
     }
 
     void Handle() final {
-        // FSM
-        enum class RxState_e {
-            IDLE,
-            RX,
-        };
-
-        static RxState_e state = RxState_e::IDLE;
-        static uint8_t cnt = 0;
-
-        switch (state) {
-            case RxState_e::IDLE:
-                if (waitForResponse) {
-                    state = RxState_e::RX;
-                    cnt = RS485_RX_MAX_MS - 1;
-                }
-                break;
-            case RxState_e::RX:
-                cnt--;
-                if (!waitForResponse || cnt == 0) {
-                    state = RxState_e::IDLE;
-                    waitForResponse = false;
-                    RS485FlowControl<ID>::Switch2Tx();
-                    UART_Base<BSP_RS485UARTIndexList[ID]>::GetInstance().TxLoader();
-                }
-                break;
+        CriticalSection cs;
+        if (active != nullptr && awaitingResponse && static_cast<int32_t>(HAL_GetTick() - deadlineTick) >= 0) {
+            active->stats.timeouts++;
+            active = nullptr;
+            awaitingResponse = false;
+            Schedule();
         }
     }
 
     void RxHandle(uint8_t *data, size_t size) {
-        uint8_t id = data[0];
-        if (agentMap[id]) {
-            agentMap[id]->Decode(data, size);
+        if (size == 0) {
+            return;
+        }
+        if (active != nullptr && awaitingResponse) {
+            uint32_t rxCycles = CycleCounter<>::Now();
+            RS485_Agent<ID> *agent = active;
+            uint32_t latency = CycleCounter<>::ToMicros(rxCycles - txCompleteCycles);
+            agent->stats.responses++;
+            agent->stats.lastLatencyUs = latency;
+            if (latency > agent->stats.maxLatencyUs) {
+                agent->stats.maxLatencyUs = latency;
+            }
+            active = nullptr;
+            awaitingResponse = false;
+            agent->Decode(data, size);
+            if (Schedule()) {
+                uint32_t turnaround = CycleCounter<>::ToMicros(CycleCounter<>::Now() - rxCycles);
+                busStats.turnarounds++;
+                busStats.lastTurnaroundUs = turnaround;
+                if (turnaround > busStats.maxTurnaroundUs) {
+                    busStats.maxTurnaroundUs = turnaround;
+                }
+            }
+            return;
+        }
+
+        // 无进行中的事务时按首字节匹配从机地址，兼容主动上报的从机
+        for (size_t i = 0; i < agentCount; ++i) {
+            if (agents[i]->addr == data[0]) {
+                agents[i]->Decode(data, size);
+                return;
+            }
+        }
+    }
+
+    /**
+     * @return 地址为addr的从机的事务统计，未注册时返回nullptr
+     */
+    const RS485_Stats_t *GetStats(uint8_t addr) const {
+        for (size_t i = 0; i < agentCount; ++i) {
+            if (agents[i]->addr == addr) {
+                return &agents[i]->stats;
+            }
         }
-        waitForResponse = false;
+        return nullptr;
     }
 
-    void Transmit(uint8_t *data, size_t size) {
-        UART_Base<BSP_RS485UARTIndexList[ID]>::GetInstance().Transmit(data, size);
+    const RS485_BusStats_t &GetBusStats() const {
+        return busStats;
     }
 
 private:
     RS485_Base(): buffer([this](uint8_t *data, size_t size) {
         RxHandle(data, size);
     }) {
+        RS485FlowControl<ID>::Init();
         UART_Base<BSP_RS485UARTIndexList[ID]>::GetInstance().BindTxHandle([this] {
             return OnTxComplete();
         });
     }
 
+    void Register(RS485_Agent<ID> *agent) {
+        if (agentCount < RS485_AGENT_SIZE) {
+            agents[agentCount++] = agent;
+        }
+    }
+
+    /**
+     * 挂起agent的请求，buffer须由UART_Base::AcquireTxBuffer申请，此后由调度器负责提交或归还
+     */
+    bool Submit(RS485_Agent<ID> *agent, uint8_t *buffer, size_t size) {
+        auto &uart = UART_Base<BSP_RS485UARTIndexList[ID]>::GetInstance();
+        if (size == 0 || size > UART_TX_SLOT_SIZE) {
+            uart.Release(buffer);
+            return false;
+        }
+        CriticalSection cs;
+        if (agent->pending != nullptr) {
+            uart.Release(agent->pending);
+            agent->stats.replaced++;
+        }
+        agent->pending = buffer;
+        agent->pendingSize = size;
+        Schedule();
+        return true;
+    }
+
+    /**
+     * 总线空闲时选择下一条请求：优先级最高者，同优先级从上次发出者的下一个开始轮询
+     * @return 是否发出了新的请求
+     */
+    bool Schedule() {
+        CriticalSection cs;
+        if (active != nullptr) {
+            return false;
+        }
+
+        RS485_Agent<ID> *next = nullptr;
+        size_t nextIndex = 0;
+        for (size_t i = 0; i < agentCount; ++i) {
+            size_t index = (cursor + i) % agentCount;
+            RS485_Agent<ID> *agent = agents[index];
+            if (agent->pending != nullptr && (next == nullptr || agent->priority < next->priority)) {
+                next = agent;
+                nextIndex = index;
+            }
+        }
+        if (next == nullptr) {
+            return false;
+        }
+
+        cursor = (nextIndex + 1) % agentCount;
+        active = next;
+        uint8_t *request = next->pending;
+        next->pending = nullptr;
+        next->stats.transactions++;
+
+        RS485FlowControl<ID>::Switch2Tx();
+        UART_Base<BSP_RS485UARTIndexList[ID]>::GetInstance().Commit(request, next->pendingSize);
+        return true;
+    }
+
+    /**
+     * 在发送完成中断中切换为接收并开始计算应答窗口，窗口向上取整到毫秒后再留一个Handle周期
+     */
     bool OnTxComplete() {
         RS485FlowControl<ID>::Switch2Rx();
-        waitForResponse = true;
+        if (active != nullptr) {
+            uint32_t baudRate = BSP_UARTList[BSP_RS485UARTIndexList[ID]]->Init.BaudRate;
+            uint32_t windowUs = static_cast<uint32_t>(static_cast<uint64_t>(active->responseLength) *
+                                                      RS485_CHAR_BITS * 1000000u / baudRate) + RS485_TURNAROUND_US;
+            txCompleteCycles = CycleCounter<>::Now();
+            deadlineTick = HAL_GetTick() + (windowUs + 999) / 1000 + 1;
+            awaitingResponse = true;
+        }
         return false;
     }
 
-    bool waitForResponse = false;
+    RS485_Agent<ID> *agents[RS485_AGENT_SIZE] = {};
+    size_t agentCount = 0;
+    size_t cursor = 0;
+
+    RS485_Agent<ID> *active = nullptr;
+    bool awaitingResponse = false;
+    uint32_t txCompleteCycles = 0;
+    uint32_t deadlineTick = 0;
+    RS485_BusStats_t busStats = {};
 
-    UARTBuffer<ID, RS485_RX_BUFFER_LENGTH> buffer;
+    UARTBuffer<BSP_RS485UARTIndexList[ID], RS485_RX_BUFFER_LENGTH> buffer;
     friend class RS485_Agent<ID>;
-    etl::map<uint8_t, RS485_Agent<ID> *, RS485_AGENT_SIZE> agentMap;
 };
 
 template<size_t ID>
 class RS485_Agent {
 public:
-    RS485_Agent(uint8_t _addr, std::function<void(uint8_t *data, size_t size)> _decodeFunc): addr(_addr),
+    /**
+     * @param _responseLength 从机应答帧长，用于计算超时窗口
+     */
+    RS485_Agent(uint8_t _addr, std::function<void(uint8_t *data, size_t size)> _decodeFunc,
+                uint16_t _responseLength = RS485_RX_BUFFER_LENGTH): addr(_addr), responseLength(_responseLength),
         decodeFunc(_decodeFunc) {
         static_assert((ID > 0) && (ID <= RS485_BUS_MAXIMUM_COUNT), "Using illegal RS485 BUS");
-        RS485_Base<ID>::GetInstance().agentMap[addr] = this;
+        RS485_Base<ID>::GetInstance().Register(this);
     }
 
     void Decode(uint8_t *data, size_t size) {
         decodeFunc(data, size);
     }
 
-    void Transmit(uint8_t *data, size_t size) {
-        RS485_Base<ID>::GetInstance().Transmit(data, size);
+    bool Transmit(const uint8_t *data, size_t size) {
+        IOVec_t segment = {data, static_cast<uint16_t>(size)};
+        return TransmitV(&segment, 1);
+    }
+
+    /**
+     * 分段组帧后挂起为本从机的请求，各段返回后即可复用
+     * @return 总长超出单个发送缓冲区或无空闲缓冲区时返回false
+     */
+    bool TransmitV(const IOVec_t *segments, size_t count) {
+        size_t size = IOVecSize(segments, count);
+        if (size > UART_TX_SLOT_SIZE) {
+            return false;
+        }
+        uint8_t *buffer = AcquireTxBuffer();
+        if (buffer == nullptr) {
+            return false;
+        }
+        size_t offset = 0;
+        for (size_t i = 0; i < count; ++i) {
+            memcpy(buffer + offset, segments[i].data, segments[i].size);
+            offset += segments[i].size;
+        }
+        return Commit(buffer, size);
+    }
+
+    /**
+     * 申请串口发送缓冲区，原地组帧后调用Commit挂起为本从机的请求，发送完成后自动归还
+     */
+    uint8_t *AcquireTxBuffer() {
+        return UART_Base<BSP_RS485UARTIndexList[ID]>::GetInstance().AcquireTxBuffer();
+    }
+
+    bool Commit(uint8_t *buffer, size_t size) {
+        return RS485_Base<ID>::GetInstance().Submit(this, buffer, size);
+    }
+
+    void SetPriority(RS485_Priority_e _priority) {
+        priority = _priority;
+    }
+
+    const RS485_Stats_t &GetStats() const {
+        return stats;
     }
 
 private:
-    uint32_t addr;
+    friend class RS485_Base<ID>;
+
+    uint8_t addr;
+    uint16_t responseLength;
+    RS485_Priority_e priority = RS485_Priority_e::Normal;
+    uint8_t *pending = nullptr;
+    uint16_t pendingSize = 0;
+    RS485_Stats_t stats = {};
     std::function<void(uint8_t *data, size_t size)> decodeFunc;
 };
 
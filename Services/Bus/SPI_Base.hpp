@@ -0,0 +1,343 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_SPI_BASE_HPP
+#define FINEMOTE_SPI_BASE_HPP
+
+#include <cstring>
+#include <functional>
+
+#include "BSP_SPI.h"
+#include "CriticalSection.hpp"
+#include "IOVec.hpp"
+
+#define SPI_TRANSACTION_QUEUE_SIZE 16   // 每条总线可排队的传输段数
+#define SPI_INLINE_DATA_SIZE 8          // 发送数据在队列中保存的长度，更长的数据直接引用调用者的缓冲区
+
+typedef struct {
+    uint32_t transactions;      // 成功完成的请求数
+    uint32_t errors;            // 失败的请求数，包括启动失败与传输错误
+    uint32_t dropped;           // 因队列已满而被拒绝的请求数
+    uint32_t reconfigurations;  // 切换从机时改写时钟配置的次数
+    uint32_t peakQueue;         // 同时排队的最大传输段数
+} SPI_Stats_t;
+
+template<uint8_t ID>
+class SPI_Agent;
+
+/**
+ * SPI总线的传输队列，队列为定长环形数组，入队与传输过程中均不分配内存
+ * @note 一个请求由若干传输段组成并连续入队，片选在首段开始前拉低、末段结束后释放，其中一段失败时丢弃同请求的剩余段
+ * @note 传输在完成中断中直接启动下一段；切换到时钟配置不同的从机时先改写外设配置，此时所有片选均已释放
+ */
+template<uint8_t ID>
+class SPI_Base {
+public:
+    static SPI_Base &GetInstance() {
+        static SPI_Base instance;
+        return instance;
+    }
+
+    SPI_Base(const SPI_Base &) = delete;
+
+    SPI_Base &operator=(const SPI_Base &) = delete;
+
+    /**
+     * 在HAL的传输完成或错误回调中调用
+     */
+    void CompleteHandle(bool ok) {
+        Finish(ok);
+    }
+
+    const SPI_Stats_t &GetStats() const {
+        return stats;
+    }
+
+    size_t GetQueueSize() const {
+        return count;
+    }
+
+private:
+    typedef struct {
+        SPI_Agent<ID> *agent;
+        const uint8_t *tx;      // 为nullptr时只接收
+        uint8_t *rx;            // 为nullptr时只发送
+        uint16_t size;
+        bool last;              // 请求的最后一段，完成后释放片选并回调
+        uint8_t data[SPI_INLINE_DATA_SIZE];
+    } Segment_t;
+
+    SPI_Base() {
+        static_assert((ID > 0) && (ID <= SPI_BUS_MAXIMUM_COUNT), "Using illegal SPI BUS");
+        BSP_SPI<ID>::GetInstance();
+    }
+
+    /**
+     * 将n个传输段连续入队，fill(segment, i)填写第i段
+     * @return 空间不足时全部丢弃并返回false
+     */
+    template<typename F>
+    bool Enqueue(size_t n, F fill) {
+        bool started = true;
+        {
+            CriticalSection cs;
+            if (n == 0 || count + n > SPI_TRANSACTION_QUEUE_SIZE) {
+                stats.dropped++;
+                return false;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                fill(queue[(head + count + i) % SPI_TRANSACTION_QUEUE_SIZE], i);
+            }
+            count += n;
+            if (count > stats.peakQueue) {
+                stats.peakQueue = count;
+            }
+            if (!busy) {
+                started = Start();
+            }
+        }
+        if (!started) {
+            Finish(false);
+        }
+        return true;
+    }
+
+    /**
+     * 启动队首传输段，需在临界区中且总线空闲时调用；请求的首段先按从机配置外设并拉低片选
+     * @return 启动失败时返回false，此时仍视为忙，由调用者以失败结束该段
+     */
+    bool Start() {
+        if (count == 0) {
+            return true;
+        }
+        Segment_t &s = queue[head];
+        busy = true;
+        BSP_SPI<ID> &bsp = BSP_SPI<ID>::GetInstance();
+        if (selected == nullptr) {
+            if (bsp.GetConfig() != s.agent->config) {
+                bsp.Configure(s.agent->config);
+                stats.reconfigurations++;
+            }
+            selected = s.agent;
+            selected->Select();
+        }
+        if (s.tx == nullptr) {
+            return bsp.Receive(s.rx, s.size);
+        }
+        if (s.rx == nullptr) {
+            return bsp.Transmit(s.tx, s.size);
+        }
+        return bsp.TransmitReceive(s.tx, s.rx, s.size);
+    }
+
+    /**
+     * 以ok结束当前传输段并启动下一段，请求结束时释放片选并在临界区外回调
+     */
+    void Finish(bool ok) {
+        while (true) {
+            Segment_t done;
+            bool started;
+            {
+                CriticalSection cs;
+                if (!busy) {
+                    return;
+                }
+                busy = false;
+                done = queue[head];
+                Pop();
+                while (!ok && !done.last && count > 0) {
+                    done = queue[head];
+                    Pop();
+                }
+                if (done.last) {
+                    selected->Deselect();
+                    selected = nullptr;
+                    done.agent->pending--;
+                    ok ? stats.transactions++ : stats.errors++;
+                }
+                started = Start();
+            }
+            if (done.last) {
+                done.agent->Complete(done.rx, done.size, ok);
+            }
+            if (started) {
+                return;
+            }
+            ok = false;
+        }
+    }
+
+    void Pop() {
+        head = (head + 1) % SPI_TRANSACTION_QUEUE_SIZE;
+        count--;
+    }
+
+    Segment_t queue[SPI_TRANSACTION_QUEUE_SIZE] = {};
+    size_t head = 0;
+    size_t count = 0;
+    bool busy = false;
+    SPI_Agent<ID> *selected = nullptr;
+    SPI_Stats_t stats = {};
+
+    friend class SPI_Agent<ID>;
+};
+
+/**
+ * SPI从机代理，每个代理对应一个片选引脚，请求均为非阻塞，入队失败时返回false
+ * @note 片选引脚需在CubeMX中配置为推挽输出；同一总线上的从机可使用不同的时钟配置
+ * @note 回调在传输完成中断中执行，参数为请求最后一段的接收缓冲区（只发送时为nullptr）、长度与是否成功
+ */
+template<uint8_t ID>
+class SPI_Agent {
+public:
+    using Callback_t = std::function<void(uint8_t *data, uint16_t size, bool ok)>;
+
+    SPI_Agent(GPIO_TypeDef *_csPort, uint16_t _csPin, Callback_t _callback = nullptr)
+        : csPort(_csPort), csPin(_csPin), config(BSP_SPI<ID>::GetInstance().GetConfig()), callback(_callback) {
+        SPI_Base<ID>::GetInstance();
+        Deselect();
+    }
+
+    /**
+     * 全双工传输，txData为nullptr时只接收，rxData为nullptr时只发送
+     * @note 不超过SPI_INLINE_DATA_SIZE的发送数据复制到队列中，返回后即可复用；更长的数据与接收缓冲区需保证在回调前有效
+     */
+    bool Transfer(const uint8_t *txData, uint8_t *rxData, uint16_t size) {
+        if (size == 0 || (txData == nullptr && rxData == nullptr)) {
+            return false;
+        }
+        return SPI_Base<ID>::GetInstance().Enqueue(1, [&](typename SPI_Base<ID>::Segment_t &s, size_t) {
+            Fill(s, txData, rxData, size, true);
+        });
+    }
+
+    bool Write(const uint8_t *data, uint16_t size) {
+        return Transfer(data, nullptr, size);
+    }
+
+    /**
+     * 多段数据在一次片选内连续发送，数据的生命周期要求与Transfer相同
+     */
+    bool WriteV(const IOVec_t *segments, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            if (segments[i].size == 0) {
+                return false;
+            }
+        }
+        return SPI_Base<ID>::GetInstance().Enqueue(count, [&](typename SPI_Base<ID>::Segment_t &s, size_t i) {
+            Fill(s, segments[i].data, nullptr, segments[i].size, i == count - 1);
+        });
+    }
+
+    /**
+     * 在一次片选内先发送命令再接收size字节，用于Flash等先发命令与地址的器件
+     */
+    bool WriteRead(const uint8_t *cmd, uint16_t cmdSize, uint8_t *rxData, uint16_t size) {
+        if (cmdSize == 0 || size == 0) {
+            return false;
+        }
+        return SPI_Base<ID>::GetInstance().Enqueue(2, [&](typename SPI_Base<ID>::Segment_t &s, size_t i) {
+            if (i == 0) {
+                Fill(s, cmd, nullptr, cmdSize, false);
+            } else {
+                Fill(s, nullptr, rxData, size, true);
+            }
+        });
+    }
+
+    /**
+     * 读取从reg开始的size字节，寄存器地址最高位置1表示读
+     * @param dummy 地址之后数据之前需丢弃的字节数，如BMI088加速度计为1
+     */
+    bool ReadRegister(uint8_t reg, uint8_t *data, uint16_t size, uint8_t dummy = 0) {
+        uint8_t cmd[SPI_INLINE_DATA_SIZE] = {static_cast<uint8_t>(reg | 0x80)};
+        if (dummy + 1 > SPI_INLINE_DATA_SIZE) {
+            return false;
+        }
+        return WriteRead(cmd, dummy + 1, data, size);
+    }
+
+    bool WriteRegister(uint8_t reg, uint8_t value) {
+        uint8_t data[2] = {static_cast<uint8_t>(reg & 0x7F), value};
+        return Write(data, 2);
+    }
+
+    /**
+     * 设置本从机的时钟分频与模式，默认为CubeMX中的配置；在本从机的下一个请求开始时生效
+     */
+    void SetConfig(const SPI_Config_t &_config) {
+        config = _config;
+    }
+
+    /**
+     * @return 是否有已入队但尚未回调的请求，高频轮询可据此跳过本周期，避免在总线跟不上时积压过期的读取
+     */
+    bool IsBusy() const {
+        return pending > 0;
+    }
+
+private:
+    friend class SPI_Base<ID>;
+
+    void Fill(typename SPI_Base<ID>::Segment_t &s, const uint8_t *txData, uint8_t *rxData, uint16_t size, bool last) {
+        s.agent = this;
+        s.rx = rxData;
+        s.size = size;
+        s.last = last;
+        if (txData != nullptr && size <= SPI_INLINE_DATA_SIZE) {
+            memcpy(s.data, txData, size);
+            s.tx = s.data;
+        } else {
+            s.tx = txData;
+        }
+        if (last) {
+            pending++;
+        }
+    }
+
+    void Select() {
+        HAL_GPIO_WritePin(csPort, csPin, GPIO_PIN_RESET);
+    }
+
+    void Deselect() {
+        HAL_GPIO_WritePin(csPort, csPin, GPIO_PIN_SET);
+    }
+
+    void Complete(uint8_t *data, uint16_t size, bool ok) {
+        if (callback) {
+            callback(data, size, ok);
+        }
+    }
+
+    GPIO_TypeDef *csPort;
+    uint16_t csPin;
+    SPI_Config_t config;
+    volatile uint8_t pending = 0;
+    Callback_t callback;
+};
+
+template<typename T = decltype(BSP_SPIList[0])>
+class FineMoteAux_SPI {
+public:
+    static void OnComplete(T &instance, bool ok) {
+        CompleteImpl<SPI_BUS_MAXIMUM_COUNT>(instance, ok);
+    }
+
+    template<size_t ID>
+    static void CompleteImpl(T &instance, bool ok) {
+        if constexpr (BSP_SPIList[ID] != nullptr) {
+            if (instance == BSP_SPIList[ID]) {
+                SPI_Base<ID>::GetInstance().CompleteHandle(ok);
+                return;
+            }
+        }
+        if constexpr (ID > 1) {
+            CompleteImpl<ID - 1>(instance, ok);
+        }
+    }
+};
+
+#endif
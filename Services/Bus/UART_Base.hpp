@@ -7,13 +7,30 @@
 #ifndef FINEMOTE_UART_BASE_HPP
 #define FINEMOTE_UART_BASE_HPP
 
+#include <cstring>
 #include <functional>
 
 #include "etl/queue.h"
 #include "DoubleBuffer.hpp"
+#include "RingBuffer.hpp"
+#include "CriticalSection.hpp"
+#include "IOVec.hpp"
 #include "BSP_UART.h"
 
-#define UART_TX_QUEUE_SIZE 20
+#define UART_TX_SLOT_COUNT 8     // 每个串口的发送缓冲区个数
+#define UART_TX_SLOT_SIZE 64     // 单个发送缓冲区容量
+#define UART_RX_RING_SIZE 128   // 循环DMA接收缓冲区（字节流模式下兼作中断接收缓冲区）大小，需大于两次接收事件之间到达的字节数
+
+typedef struct {
+    uint32_t irqCount;      // 串口及其DMA流的中断次数，用于比较中断与DMA模式的开销
+    uint32_t rxEvents;      // 接收事件回调次数，循环DMA模式下包括空闲、半满与全满事件
+    uint32_t txEvents;      // 发送完成回调次数
+    uint32_t rxBytes;
+    uint32_t txBytes;
+    uint32_t rxFrames;      // 提交给UARTBuffer解析的帧数
+    uint32_t errors;
+    uint32_t txOverflow;    // 因无空闲发送缓冲区而被拒绝的发送次数
+} UART_Stats_t;
 
 template<uint8_t ID>
 class UART_Base;
@@ -27,6 +44,18 @@ public:
     }
 };
 
+/**
+ * 串口字节流，中断中只将收到的字节写入环形缓冲区，由任务或设备Handle配合FrameExtractor组帧解析
+ * @note 适用于帧可能跨越多次空闲事件、或一次空闲事件包含多帧的协议；与UARTBuffer不可绑定同一串口
+ */
+template<size_t ID, size_t N>
+class UARTStream : public RingBuffer<N> {
+public:
+    UARTStream() {
+        UART_Base<ID>::GetInstance().Bind(*this);
+    }
+};
+
 template<uint8_t ID>
 class UART_Base {
 public:
@@ -45,7 +74,23 @@ public:
             buffer.CommitBuffer(size);
         };
 
-        BSP_UART<ID>::GetInstance().Receive(*bufferHead, rxLength);
+        if (BSP_UART<ID>::GetInstance().IsRxCircular()) {
+            frameBuffer = *bufferHead;
+            frameLength = 0;
+            ringTail = 0;
+            BSP_UART<ID>::GetInstance().Receive(rxRing, UART_RX_RING_SIZE);
+        } else {
+            BSP_UART<ID>::GetInstance().Receive(*bufferHead, rxLength);
+        }
+    }
+
+    template<size_t N>
+    void Bind(UARTStream<ID, N> &stream) {
+        streamPushFunc = [&stream](const uint8_t *data, size_t size) {
+            stream.Push(data, size);
+        };
+        ringTail = 0;
+        BSP_UART<ID>::GetInstance().Receive(rxRing, UART_RX_RING_SIZE);
     }
 
     void BindTxHandle(std::function<bool()> txFunc) {
@@ -54,26 +99,126 @@ public:
 
     /*** Part 2: Transmit ***/
 
-    void Transmit(uint8_t *data, uint16_t size) {
-        if (txQueue.full()) {
-            txQueue.pop(); // Todo
+    /**
+     * 申请一个发送缓冲区，调用者在其中原地组帧后调用Commit发送
+     * @return 容量为UART_TX_SLOT_SIZE的缓冲区；无空闲缓冲区时返回nullptr并计入txOverflow
+     * @note 缓冲区在发送完成中断中自动归还，Commit后调用者不可再访问
+     */
+    uint8_t *AcquireTxBuffer() {
+        CriticalSection cs;
+        for (size_t i = 0; i < UART_TX_SLOT_COUNT; ++i) {
+            if (slotState[i] == TxSlot_e::Free) {
+                slotState[i] = TxSlot_e::Acquired;
+                return txPool[i];
+            }
+        }
+        stats.txOverflow++;
+        return nullptr;
+    }
+
+    /**
+     * 将AcquireTxBuffer申请的缓冲区加入发送队列
+     * @return 缓冲区不属于本串口、未申请或size超出容量时返回false，此时缓冲区仍归调用者所有
+     */
+    bool Commit(uint8_t *buffer, uint16_t size) {
+        size_t slot = SlotOf(buffer);
+        CriticalSection cs;
+        if (slot >= UART_TX_SLOT_COUNT || slotState[slot] != TxSlot_e::Acquired || size == 0 ||
+            size > UART_TX_SLOT_SIZE) {
+            return false;
         }
-        txQueue.push(std::make_pair(data, size)); // Push or Emplace?
+        slotState[slot] = TxSlot_e::Queued;
+        txQueue.push(std::make_pair(static_cast<uint8_t>(slot), size));
 
         if (isTxComplete) {
             TxLoader();
         }
+        return true;
+    }
+
+    /**
+     * 放弃已申请但未提交的缓冲区
+     */
+    void Release(uint8_t *buffer) {
+        size_t slot = SlotOf(buffer);
+        CriticalSection cs;
+        if (slot < UART_TX_SLOT_COUNT && slotState[slot] == TxSlot_e::Acquired) {
+            slotState[slot] = TxSlot_e::Free;
+        }
+    }
+
+    /**
+     * 将data复制到发送缓冲区后发送，超过单个缓冲区的数据分段发送，返回后data即可复用
+     * @return 空闲缓冲区不足时整段丢弃，计入txOverflow并返回false
+     */
+    bool Transmit(const uint8_t *data, uint16_t size) {
+        IOVec_t segment = {data, size};
+        return TransmitV(&segment, 1);
+    }
+
+    /**
+     * 将多段数据按顺序直接拼接到发送缓冲区后发送，调用者无需先组成连续的帧
+     * @note 各段在返回后即可复用；校验可用CRC*Calc(segments, count)对同一组分段计算
+     * @return 空闲缓冲区不足时整段丢弃，计入txOverflow并返回false
+     */
+    bool TransmitV(const IOVec_t *segments, size_t count) {
+        size_t size = IOVecSize(segments, count);
+        size_t required = (size + UART_TX_SLOT_SIZE - 1) / UART_TX_SLOT_SIZE;
+        CriticalSection cs;
+        size_t freeSlots = 0;
+        for (size_t i = 0; i < UART_TX_SLOT_COUNT; ++i) {
+            freeSlots += slotState[i] == TxSlot_e::Free;
+        }
+        if (freeSlots < required) {
+            stats.txOverflow++;
+            return false;
+        }
+
+        uint8_t *buffer = nullptr;
+        uint16_t filled = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const uint8_t *data = segments[i].data;
+            uint16_t remain = segments[i].size;
+            while (remain > 0) {
+                if (buffer == nullptr) {
+                    buffer = AcquireTxBuffer();
+                    filled = 0;
+                }
+                uint16_t n = remain < UART_TX_SLOT_SIZE - filled ? remain : UART_TX_SLOT_SIZE - filled;
+                memcpy(buffer + filled, data, n);
+                filled += n;
+                data += n;
+                remain -= n;
+                if (filled == UART_TX_SLOT_SIZE) {
+                    Commit(buffer, filled);
+                    buffer = nullptr;
+                }
+            }
+        }
+        if (buffer != nullptr) {
+            Commit(buffer, filled);
+        }
+        return true;
     }
 
     void TxLoader() {
+        CriticalSection cs;
         if (!txQueue.empty()) {
-            BSP_UART<ID>::GetInstance().Transmit(txQueue.front().first, txQueue.front().second);
+            sendingSlot = txQueue.front().first;
+            slotState[sendingSlot] = TxSlot_e::Sending;
+            stats.txBytes += txQueue.front().second;
+            BSP_UART<ID>::GetInstance().Transmit(txPool[sendingSlot], txQueue.front().second);
             txQueue.pop();
             isTxComplete = false;
         }
     }
 
     void TxHandle() {
+        stats.txEvents++;
+        if (sendingSlot < UART_TX_SLOT_COUNT) {
+            slotState[sendingSlot] = TxSlot_e::Free;
+            sendingSlot = UART_TX_SLOT_COUNT;
+        }
         isTxComplete = true;
         if (OnTxCompleteFunc()) {
             TxLoader();
@@ -82,9 +227,80 @@ public:
 
     /*** Part 3: Receive ***/
 
+    /**
+     * @param size 中断模式下为接收到的字节数，循环DMA模式下为DMA在缓冲区中的写入位置
+     * @note 循环DMA模式下按中断模式的语义组帧：收到空闲事件或累计满rxLength字节时提交给UARTBuffer
+     */
     void RxHandle(uint16_t size) {
-        BSP_UART<ID>::GetInstance().Receive(*bufferHead, rxLength);
-        commitBufferFunc(size);
+        stats.rxEvents++;
+        if (streamPushFunc) {
+            StreamRxHandle(size);
+            return;
+        }
+        if (bufferHead == nullptr) {
+            return;
+        }
+
+        if (!BSP_UART<ID>::GetInstance().IsRxCircular()) {
+            stats.rxBytes += size;
+            BSP_UART<ID>::GetInstance().Receive(*bufferHead, rxLength);
+            CommitFrame(size);
+            return;
+        }
+
+        // 全满事件的写入位置等于缓冲区大小，即回绕到0；半满与全满事件保证两次事件间不会超过一整圈
+        uint16_t head = size % UART_RX_RING_SIZE;
+        while (ringTail != head) {
+            uint16_t end = head > ringTail ? head : UART_RX_RING_SIZE;
+            size_t n = end - ringTail;
+            if (n > rxLength - frameLength) {
+                n = rxLength - frameLength;
+            }
+            memcpy(frameBuffer + frameLength, rxRing + ringTail, n);
+            frameLength += n;
+            ringTail = (ringTail + n) % UART_RX_RING_SIZE;
+            stats.rxBytes += n;
+            if (frameLength == rxLength) {
+                CommitCircular();
+            }
+        }
+        if (BSP_UART<ID>::GetInstance().GetRxEventType() == HAL_UART_RXEVENT_IDLE && frameLength > 0) {
+            CommitCircular();
+        }
+    }
+
+    /**
+     * 中断模式下与原有行为一致，提交空帧并重新开始接收；循环DMA模式下HAL已停止DMA，丢弃未完成的帧后重新启动
+     */
+    void ErrorHandle() {
+        stats.errors++;
+        if (streamPushFunc) {
+            ringTail = 0;
+            BSP_UART<ID>::GetInstance().Receive(rxRing, UART_RX_RING_SIZE);
+            return;
+        }
+        if (bufferHead == nullptr) {
+            return;
+        }
+        if (BSP_UART<ID>::GetInstance().IsRxCircular()) {
+            frameLength = 0;
+            ringTail = 0;
+            BSP_UART<ID>::GetInstance().Receive(rxRing, UART_RX_RING_SIZE);
+        } else {
+            BSP_UART<ID>::GetInstance().Receive(*bufferHead, rxLength);
+            CommitFrame(0);
+        }
+    }
+
+    void IRQHandle() {
+        stats.irqCount++;
+        if (frameLength > 0 && BSP_UART<ID>::GetInstance().IsIdleAtWrap()) {
+            CommitCircular();
+        }
+    }
+
+    const UART_Stats_t &GetStats() const {
+        return stats;
     }
 
 private:
@@ -93,13 +309,74 @@ private:
         BSP_UART<ID>::GetInstance();
     }
 
+    size_t SlotOf(const uint8_t *buffer) const {
+        for (size_t i = 0; i < UART_TX_SLOT_COUNT; ++i) {
+            if (buffer == txPool[i]) {
+                return i;
+            }
+        }
+        return UART_TX_SLOT_COUNT;
+    }
+
+    void CommitFrame(size_t size) {
+        stats.rxFrames++;
+        commitBufferFunc(size);
+    }
+
+    /**
+     * 字节流模式下rxRing在中断模式中作为单次接收缓冲区，在循环DMA模式中作为DMA环形缓冲区
+     */
+    void StreamRxHandle(uint16_t size) {
+        if (!BSP_UART<ID>::GetInstance().IsRxCircular()) {
+            stats.rxBytes += size;
+            streamPushFunc(rxRing, size);
+            BSP_UART<ID>::GetInstance().Receive(rxRing, UART_RX_RING_SIZE);
+            return;
+        }
+
+        uint16_t head = size % UART_RX_RING_SIZE;
+        while (ringTail != head) {
+            uint16_t end = head > ringTail ? head : UART_RX_RING_SIZE;
+            stats.rxBytes += end - ringTail;
+            streamPushFunc(rxRing + ringTail, end - ringTail);
+            ringTail = end % UART_RX_RING_SIZE;
+        }
+    }
+
+    /**
+     * 提交后UARTBuffer切换到刚组好的缓冲区进行解析，下一帧写入另一缓冲区，即提交前的*bufferHead
+     */
+    void CommitCircular() {
+        uint8_t *next = *bufferHead;
+        CommitFrame(frameLength);
+        frameBuffer = next;
+        frameLength = 0;
+    }
+
     bool isTxComplete = true;
+    UART_Stats_t stats = {};
 
     uint8_t **bufferHead = nullptr;
     size_t rxLength;
     std::function<void(size_t)> commitBufferFunc;
+    std::function<void(const uint8_t *, size_t)> streamPushFunc;
+
+    uint8_t rxRing[UART_RX_RING_SIZE] = {};
+    uint16_t ringTail = 0;
+    uint8_t *frameBuffer = nullptr;
+    size_t frameLength = 0;
 
-    etl::queue<std::pair<uint8_t *, uint16_t>, UART_TX_QUEUE_SIZE> txQueue;
+    enum class TxSlot_e : uint8_t {
+        Free,
+        Acquired,   // 已由调用者申请，正在组帧
+        Queued,
+        Sending,
+    };
+
+    uint8_t txPool[UART_TX_SLOT_COUNT][UART_TX_SLOT_SIZE] = {};
+    TxSlot_e slotState[UART_TX_SLOT_COUNT] = {};
+    size_t sendingSlot = UART_TX_SLOT_COUNT;
+    etl::queue<std::pair<uint8_t, uint16_t>, UART_TX_SLOT_COUNT> txQueue;
     std::function<bool()> OnTxCompleteFunc = [] {
         bool autoReload = true;
         return autoReload;
@@ -119,6 +396,16 @@ public:
         RxCompleteImpl<maxID>(instance, size);
     }
 
+    static void OnError(T &instance) {
+        constexpr size_t maxID = sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) - 1;
+        ErrorImpl<maxID>(instance);
+    }
+
+    static void OnIRQ(T &instance) {
+        constexpr size_t maxID = sizeof(BSP_UARTList) / sizeof(BSP_UARTList[0]) - 1;
+        IRQImpl<maxID>(instance);
+    }
+
     template<size_t ID>
     static void TxCompleteImpl(T &instance) {
         if constexpr (BSP_UARTList[ID] != nullptr) {
@@ -144,6 +431,32 @@ public:
             RxCompleteImpl<ID - 1>(instance, size);
         }
     }
+
+    template<size_t ID>
+    static void ErrorImpl(T &instance) {
+        if constexpr (BSP_UARTList[ID] != nullptr) {
+            if (instance == BSP_UARTList[ID]) {
+                UART_Base<ID>::GetInstance().ErrorHandle();
+                return;
+            }
+        }
+        if constexpr (ID > 1) {
+            ErrorImpl<ID - 1>(instance);
+        }
+    }
+
+    template<size_t ID>
+    static void IRQImpl(T &instance) {
+        if constexpr (BSP_UARTList[ID] != nullptr) {
+            if (instance == BSP_UARTList[ID]) {
+                UART_Base<ID>::GetInstance().IRQHandle();
+                return;
+            }
+        }
+        if constexpr (ID > 1) {
+            IRQImpl<ID - 1>(instance);
+        }
+    }
 };
 
 #endif
@@ -10,15 +10,34 @@
 #include "ProjectConfig.h"
 
 #include "Verification/CRC.h"
+#include "FrameExtractor.hpp"
 
 class FineSerial {
 public:
-    void Decode(uint8_t* data, uint16_t size) {
-        constexpr uint8_t FRAME_HEADER = 0xAA;
-        constexpr uint8_t FRAME_TRAILER = 0xBB;
+    static constexpr uint8_t FRAME_HEADER = 0xAA;
+    static constexpr uint8_t FRAME_TRAILER = 0xBB;
+    static constexpr size_t PAYLOAD_MIN_LENGTH = 24;            // Decode读取的6个float
+    static constexpr size_t FRAME_MAX_LENGTH = 5 + UINT8_MAX;  // 数据长度字段为1字节
+
+    /**
+     * 帧格式：帧头 | 保留 | 数据长度 | 数据 | CRC8 | 帧尾
+     * @note 数据长度不少于PAYLOAD_MIN_LENGTH，多出的数据忽略
+     */
+    static constexpr FrameFormat_t FrameFormat() {
+        return {FRAME_HEADER, 3, FrameLength, FrameCheck};
+    }
+
+    static size_t FrameLength(const uint8_t *prefix) {
+        return 5 + prefix[2];
+    }
 
-        uint8_t crc = CRC8Calc(data + 3, size - 5);
-        if (data[0] != FRAME_HEADER || data[size - 1] != FRAME_TRAILER || data[size - 2] != crc || size != 5 + data[2]) {
+    static bool FrameCheck(const uint8_t *data, size_t size) {
+        return size >= 5 + PAYLOAD_MIN_LENGTH && data[2] >= PAYLOAD_MIN_LENGTH && data[0] == FRAME_HEADER && data[size - 1] == FRAME_TRAILER &&
+               data[size - 2] == CRC8Calc(data + 3, size - 5) && size == FrameLength(data);
+    }
+
+    void Decode(uint8_t* data, uint16_t size) {
+        if (!FrameCheck(data, size)) {
             return;
         }
 
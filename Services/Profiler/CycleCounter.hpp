@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_CYCLECOUNTER_HPP
+#define FINEMOTE_CYCLECOUNTER_HPP
+
+#include <cstdint>
+
+#include "Board.h"
+
+/**
+ * 周期计数源，要求提供 Init()、Now() 与 Frequency()，Now() 允许32位回绕，调用方只使用差值
+ */
+
+#if defined(DWT)
+
+/**
+ * Cortex-M 内核 DWT 周期计数器
+ */
+struct DWTCycleSource {
+    static void Init() {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    static uint32_t Now() {
+        return DWT->CYCCNT;
+    }
+
+    static uint32_t Frequency() {
+        return SystemCoreClock;
+    }
+};
+
+using DefaultCycleSource = DWTCycleSource;
+
+#else
+
+#include <chrono>
+
+/**
+ * 主机端以 std::chrono::steady_clock 的纳秒计数模拟周期计数
+ */
+struct ChronoCycleSource {
+    static void Init() {}
+
+    static uint32_t Now() {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static uint32_t Frequency() {
+        return 1000000000u;
+    }
+};
+
+using DefaultCycleSource = ChronoCycleSource;
+
+#endif
+
+template<typename Source = DefaultCycleSource>
+class CycleCounter {
+public:
+    static void Init() {
+        Source::Init();
+    }
+
+    static uint32_t Now() {
+        return Source::Now();
+    }
+
+    static uint32_t Frequency() {
+        return Source::Frequency();
+    }
+
+    static uint32_t ToMicros(uint32_t cycles) {
+        return static_cast<uint32_t>(static_cast<uint64_t>(cycles) * 1000000u / Source::Frequency());
+    }
+
+    static uint32_t FromMicros(uint32_t us) {
+        return static_cast<uint32_t>(static_cast<uint64_t>(us) * Source::Frequency() / 1000000u);
+    }
+};
+
+#endif
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright (c) 2025.
+ * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
+ * All rights reserved.
+ ******************************************************************************/
+
+#ifndef FINEMOTE_PROFILER_HPP
+#define FINEMOTE_PROFILER_HPP
+
+#include <atomic>
+#include <cstring>
+
+#include "DeviceBase.h"
+#include "Scheduler.h"
+#include "Verification/CRC.h"
+#include "Profiler/CycleCounter.hpp"
+
+#define PROFILER_DEVICE_SLOTS DEVICE_REGISTRY_SIZE
+#define PROFILER_TASK_SLOTS SCHEDULER_TASK_SLOTS
+#define PROFILER_HISTOGRAM_BINS 8
+#define PROFILER_PAYLOAD_SIZE (21 + 4 * PROFILER_HISTOGRAM_BINS)
+#define PROFILER_FRAME_SIZE (5 + PROFILER_PAYLOAD_SIZE)
+
+/**
+ * 直方图按主循环周期(1ms)等分，最后一个区间同时收纳超出周期的样本
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t histogram[PROFILER_HISTOGRAM_BINS];
+} Profiler_Stats_t;
+
+enum class Profiler_Kind_e : uint8_t {
+    Loop = 0,
+    Device,
+    Task,
+};
+
+template<typename Source = DefaultCycleSource>
+class Profiler {
+public:
+    static Profiler &GetInstance() {
+        static Profiler instance;
+        return instance;
+    }
+
+    Profiler(const Profiler &) = delete;
+
+    Profiler &operator=(const Profiler &) = delete;
+
+    /*** Part 1: Record, 仅在定时中断中调用 ***/
+
+    uint32_t Begin() const {
+        return CycleCounter<Source>::Now();
+    }
+
+    void RecordDevice(uint32_t id, uint32_t start) {
+        if (id < PROFILER_DEVICE_SLOTS) {
+            Record(devices[id], CycleCounter<Source>::Now() - start);
+        }
+    }
+
+    void RecordTask(uint32_t id, uint32_t start) {
+        if (id < PROFILER_TASK_SLOTS) {
+            Record(tasks[id], CycleCounter<Source>::Now() - start);
+        }
+    }
+
+    void RecordLoop(uint32_t start) {
+        uint32_t cycles = CycleCounter<Source>::Now() - start;
+        Record(loop, cycles);
+        if (cycles > budget) {
+            overrunCount++;
+        }
+    }
+
+    /*** Part 2: Read, 可在任意低优先级上下文中调用，不关中断 ***/
+
+    uint32_t GetOverrunCount() const {
+        return overrunCount;
+    }
+
+    /**
+     * 读取一份一致的统计快照，读取期间若被记录打断则重试
+     * @return id越界时返回false
+     */
+    bool Snapshot(Profiler_Kind_e kind, uint32_t id, Profiler_Stats_t &out) const {
+        const Profiler_Stats_t *stats = Find(kind, id);
+        if (stats == nullptr) {
+            return false;
+        }
+        uint32_t before, after;
+        do {
+            before = sequence;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            memcpy(&out, stats, sizeof(Profiler_Stats_t));
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            after = sequence;
+        } while ((before & 1u) || before != after);
+        return true;
+    }
+
+    /**
+     * 按 FineSerial 帧格式打包一条统计：0xAA | kind | 长度 | 数据 | CRC8 | 0xBB
+     * 数据为 id(1) 次数 最小 最大 平均 超时次数 直方图，均为小端uint32，单位为周期数
+     * @return 帧长度，统计为空或id越界时返回0
+     */
+    size_t Serialize(Profiler_Kind_e kind, uint32_t id, uint8_t *frame) const {
+        Profiler_Stats_t stats;
+        if (!Snapshot(kind, id, stats) || stats.count == 0) {
+            return 0;
+        }
+        uint32_t fields[5] = {stats.count, stats.min, stats.max,
+                              static_cast<uint32_t>(stats.total / stats.count), overrunCount};
+
+        frame[0] = 0xAA;
+        frame[1] = static_cast<uint8_t>(kind);
+        frame[2] = PROFILER_PAYLOAD_SIZE;
+        frame[3] = static_cast<uint8_t>(id);
+        memcpy(frame + 4, fields, sizeof(fields));
+        memcpy(frame + 4 + sizeof(fields), stats.histogram, sizeof(stats.histogram));
+        frame[PROFILER_FRAME_SIZE - 2] = CRC8Calc(frame + 3, PROFILER_PAYLOAD_SIZE);
+        frame[PROFILER_FRAME_SIZE - 1] = 0xBB;
+        return PROFILER_FRAME_SIZE;
+    }
+
+    void Reset() {
+        sequence++;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        memset(&loop, 0, sizeof(loop));
+        memset(devices, 0, sizeof(devices));
+        memset(tasks, 0, sizeof(tasks));
+        overrunCount = 0;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        sequence++;
+    }
+
+private:
+    Profiler() {
+        CycleCounter<Source>::Init();
+        budget = CycleCounter<Source>::Frequency() / 1000;
+    }
+
+    void Record(Profiler_Stats_t &stats, uint32_t cycles) {
+        sequence++;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        if (stats.count == 0 || cycles < stats.min) {
+            stats.min = cycles;
+        }
+        if (cycles > stats.max) {
+            stats.max = cycles;
+        }
+        stats.count++;
+        stats.total += cycles;
+        uint32_t bin = static_cast<uint32_t>(static_cast<uint64_t>(cycles) * PROFILER_HISTOGRAM_BINS / budget);
+        stats.histogram[bin < PROFILER_HISTOGRAM_BINS ? bin : PROFILER_HISTOGRAM_BINS - 1]++;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        sequence++;
+    }
+
+    const Profiler_Stats_t *Find(Profiler_Kind_e kind, uint32_t id) const {
+        switch (kind) {
+            case Profiler_Kind_e::Loop:
+                return &loop;
+            case Profiler_Kind_e::Device:
+                return id < PROFILER_DEVICE_SLOTS ? &devices[id] : nullptr;
+            case Profiler_Kind_e::Task:
+                return id < PROFILER_TASK_SLOTS ? &tasks[id] : nullptr;
+        }
+        return nullptr;
+    }
+
+    volatile uint32_t sequence = 0;
+    uint32_t budget = 1;
+    uint32_t overrunCount = 0;
+
+    Profiler_Stats_t loop = {};
+    Profiler_Stats_t devices[PROFILER_DEVICE_SLOTS] = {};
+    Profiler_Stats_t tasks[PROFILER_TASK_SLOTS] = {};
+};
+
+#endif
@@ -1,4 +1,3 @@
-
 /*******************************************************************************
  * Copyright (c) 2024.
  * IWIN-FINS Lab, Shanghai Jiao Tong University, Shanghai, China.
@@ -9,29 +8,35 @@
 #define FINEMOTE_I2CTEST_H
 #include "ProjectConfig.h"
 #ifdef I2CTEST_COMPONENTS
-#include "Bus/I2C_Base.h"
+#include "Bus/I2C_Base.hpp"
 /**
- * I2CBase类的示例用法
+ * I2C_Base类的示例用法
  */
 class I2CTest {
     I2C_Agent<2> sensorI2C;
     uint8_t recievedMessage[2]{};
+    uint8_t status[1]{};
 public:
-    void recievedCallback(I2C_Task_t _data){
+    void recievedCallback(uint8_t reg, uint8_t *data, uint16_t size, bool ok){
+        if (!ok || data != recievedMessage) return;
         uint16_t tmp;
-        tmp = recievedMessage[0] +recievedMessage[1]<<8;
+        tmp = recievedMessage[0] + (recievedMessage[1] << 8);
     };
-    I2CTest():sensorI2C(0x40){
-        //直接使用vector类型，发送小数据
-        sensorI2C.Write({0x02,3});
-        //大批数据或重复更新数据，需保证数据生命周期
-        static uint8_t tmp[2];
-        sensorI2C.Write(tmp,2);
-        //读取数据，读取成功后调用回调函数
-        auto recievedCallbackPack = [this](I2C_Task_t a){this->recievedCallback(a);};
-        sensorI2C.Read(recievedMessage,2,recievedCallbackPack);
+    I2CTest():sensorI2C(0x40, [this](uint8_t reg, uint8_t *data, uint16_t size, bool ok) {
+        this->recievedCallback(reg, data, size, ok);
+    }){
+        //短数据复制到事务队列中，返回后即可复用
+        uint8_t config[2] = {0x02, 3};
+        sensorI2C.Write(config, 2);
+        //写寄存器
+        sensorI2C.MemWrite(0x10, config, 1);
         //总线停顿,用于等待器件处理等场景
         sensorI2C.Delay(2);
+        //读取数据，读取成功后调用回调函数
+        sensorI2C.Read(recievedMessage, 2);
+        //多段寄存器读取作为一个批次，全部完成后回调一次，适合在任务中以固定频率轮询
+        static const I2C_BurstRead_t burst[] = {{0x00, recievedMessage, 2}, {0x08, status, 1}};
+        sensorI2C.MemReadBatch(burst, 2);
     };
 };
 